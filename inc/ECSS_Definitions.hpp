@@ -84,7 +84,28 @@ inline const uint8_t ECSSTCRequestStringSize = 64;
  * The maximum number of activities that can be in the time-based schedule
  * @see TimeBasedSchedulingService
  */
-inline const uint8_t ECSSMaxNumberOfTimeSchedActivities = 10;
+inline const uint16_t ECSSMaxNumberOfTimeSchedActivities = 64;
+
+/**
+ * The number of bytes shared by the TC packets of all the activities of the time-based schedule. Each TC packet takes
+ * its own length plus 4 bytes, so this also limits the size of a single scheduled TC.
+ * @see TimeBasedSchedulingService
+ * @see RequestArena
+ */
+inline const uint16_t ECSSTimeSchedRequestArenaSize = 4096;
+
+/**
+ * The number of sub-schedules of the time-based schedule. Valid sub-schedule IDs range from 0 to
+ * `ECSSMaxTimeSchedSubSchedules - 1`.
+ * @see TimeBasedSchedulingService
+ */
+inline const uint8_t ECSSMaxTimeSchedSubSchedules = 4;
+
+/**
+ * The number of groups of the time-based schedule. Valid group IDs range from 0 to `ECSSMaxTimeSchedGroups - 1`.
+ * @see TimeBasedSchedulingService
+ */
+inline const uint8_t ECSSMaxTimeSchedGroups = 16;
 
 /**
  * @brief Time margin used in the time based command scheduling service ST[11]
@@ -101,11 +122,51 @@ inline const uint8_t ECSSTimeMarginForActivation = 60;
 inline const uint8_t ECSSEventDataAuxiliaryMaxSize = 64;
 
 /**
- * @brief Size of the multimap that holds every event-action definition
+ * @brief The max number of event-action definitions of all events
  * @see EventActionService
  */
 inline const uint16_t ECSSEventActionStructMapSize = 256;
 
+/**
+ * @brief The number of event definition IDs. Valid event definition IDs range from 0 to
+ * `ECSSEventDefinitionCount - 1`.
+ * @see EventReportService
+ */
+inline const uint16_t ECSSEventDefinitionCount = 2048;
+
+/**
+ * @brief The number of event definition IDs that can trigger event-actions, i.e. IDs from 0 to
+ * `ECSSEventActionEventDefinitionCount - 1`. Each of them costs a list of \ref ECSSMaxEventActionsPerEvent definitions
+ * and a rate-limit timestamp, so it can be smaller than \ref ECSSEventDefinitionCount.
+ * @see EventActionService
+ */
+inline const uint16_t ECSSEventActionEventDefinitionCount = 256;
+
+/**
+ * @brief The max number of events whose reports can be throttled at the same time
+ * @see EventReportService
+ */
+inline const uint8_t ECSSMaxThrottledEvents = 32;
+
+/**
+ * @brief The max number of event-action definitions that can be triggered by the same event
+ * @see EventActionService
+ */
+inline const uint8_t ECSSMaxEventActionsPerEvent = 4;
+
+/**
+ * @brief The max number of event-actions that can wait in the queue of \ref EventActionService to be executed
+ * @see EventActionService
+ */
+inline const uint8_t ECSSEventActionQueueSize = 32;
+
+/**
+ * @brief The default max number of queued event-actions executed by a single call of
+ * EventActionService::executePendingActions()
+ * @see EventActionService
+ */
+inline const uint8_t ECSSMaxEventActionsPerCall = 8;
+
 /**
  * The maximum delta between the specified release time and the actual release time
  * @see TimeBasedSchedulingService
@@ -144,21 +205,54 @@ inline const uint16_t LoggerMaxMessageSize = 512;
  */
 inline const uint8_t ECSSParameterCount = 12;
 
+/**
+ * @brief The number of sequence locks that protect the values of parameters. Parameters are spread over the locks, so
+ * that an update only makes the readers of parameters that share its lock retry. It must not exceed 32.
+ * @see ParameterBase
+ */
+inline const uint8_t ECSSParameterLockShards = 8;
+static_assert(ECSSParameterLockShards <= 32, "The lock shards of parameters are combined in a 32-bit mask");
+
+/**
+ * @brief The max number of callbacks that can be subscribed to the changes of a single parameter
+ * @see ParameterChangeNotifier
+ */
+inline const uint8_t ECSSMaxParameterSubscribers = 2;
+
 /**
  * @brief Defines whether the optional CRC field is included
  */
 inline const bool ECSSCRCIncluded = true;
 
 /**
- * Number of parameters whose statistics we need and are going to be stored into the statisticsMap
+ * Number of parameters whose statistics we need and are going to be stored by ST[04]
+ * @see StatisticsStore
  */
-inline const uint8_t ECSSMaxStatisticParameters = 4;
+inline const uint16_t ECSSMaxStatisticParameters = 4;
 
 /**
  * Whether the ST[04] statistics calculation supports the reporting of stddev
  */
 inline const bool SupportsStandardDeviation = true;
 
+/**
+ * The max number of samples kept by a windowed statistic of ST[04]
+ * @see WindowedStatistic
+ */
+inline const uint16_t ECSSStatisticWindowSize = 64;
+
+/**
+ * The max number of parameters that can have windowed statistics in ST[04] at the same time
+ */
+inline const uint8_t ECSSMaxWindowedStatistics = 4;
+
+/**
+ * The number of buckets of a quantile sketch for each sign of the values. Together with the relative accuracy of the
+ * sketch, it determines the range of magnitudes that can be told apart.
+ * @see QuantileSketch
+ */
+inline const uint16_t ECSSQuantileSketchBuckets = 256;
+
 /**
  * @brief the max number of bytes allowed for a packet store to handle in ST[15].
  */
@@ -212,6 +306,20 @@ inline const uint8_t ECSSMaxServiceTypeDefinitions = 10;
 inline const uint8_t ECSSMaxApplicationsServicesCombinations = ECSSMaxControlledApplicationProcesses *
                                                                ECSSMaxServiceTypeDefinitions;
 
+/**
+ * The number of service types covered by the forwarding filter of ST[14]. Reports of controlled application processes
+ * can only be forwarded if their service type is lower than this.
+ * @see ApplicationProcessConfiguration
+ */
+inline const uint8_t ECSSForwardingFilterServiceTypes = 32;
+
+/**
+ * The number of message types covered by the forwarding filter of ST[14]. Reports of controlled application processes
+ * can only be forwarded if their message type is lower than this.
+ * @see ApplicationProcessConfiguration
+ */
+inline const uint8_t ECSSForwardingFilterMessageTypes = 64;
+
 /**
  * The max number of event definition IDs per event report blocking type definition in the event report blocking
  * configuration
@@ -228,9 +336,34 @@ inline struct {
 } VirtualChannelLimits;
 
 /**
- * Maximum number of ST[12] Parameter Monitoring Definitions.
+ * Maximum number of ST[12] Parameter Monitoring Definitions of the expected value check type. The definitions are
+ * stored by value, so platforms that monitor more parameters should raise this.
+ */
+inline const uint16_t ECSSMaxExpectedValueCheckDefinitions = 16;
+
+/**
+ * Maximum number of ST[12] Parameter Monitoring Definitions of the limit check type. The definitions are stored by
+ * value, so platforms that monitor more parameters should raise this.
+ */
+inline const uint16_t ECSSMaxLimitCheckDefinitions = 64;
+
+/**
+ * Maximum number of ST[12] Parameter Monitoring Definitions of the delta check type. The definitions are stored by
+ * value, so platforms that monitor more parameters should raise this.
+ */
+inline const uint16_t ECSSMaxDeltaCheckDefinitions = 16;
+
+/**
+ * Maximum number of ST[12] Parameter Monitoring Definitions of all check types.
+ */
+inline const uint16_t ECSSMaxMonitoringDefinitions =
+    ECSSMaxExpectedValueCheckDefinitions + ECSSMaxLimitCheckDefinitions + ECSSMaxDeltaCheckDefinitions;
+
+/**
+ * Maximum number of ST[12] Parameter Monitoring Definitions that can be out of limits at the same time, i.e. that are
+ * reported in TM[12,11]
  */
-inline const uint8_t ECSSMaxMonitoringDefinitions = 4;
+inline const uint16_t ECSSMaxOutOfLimitsDefinitions = 64;
 
 /** @} */
 #endif // ECSS_SERVICES_ECSS_DEFINITIONS_H
@@ -93,6 +93,19 @@ public:
 		 * Invalid TimeStamp parameters at creation
 		 */
 		InvalidTimeStampInput = 15,
+		/**
+		 * A batch of samples was given with a different number of values and timestamps
+		 */
+		InvalidSampleBatch = 16,
+		/**
+		 * A parameter was accessed as a different type than the one it is stored as
+		 */
+		ParameterTypeMismatch = 17,
+		/**
+		 * The values of one or more parameters were still being written after all the read attempts, so the copy
+		 * that was used may be inconsistent
+		 */
+		InconsistentParameterRead = 18,
 	};
 
 	/**
@@ -344,6 +357,38 @@ public:
 		 * ID is not controlled by the Service (ST[14])
 		 */
 		NotControlledApplication = 50,
+		/**
+		 * Attempt to add a parameter monitoring definition with an unknown check type (ST[12])
+		 */
+		InvalidParameterMonitoringCheckType = 51,
+		/**
+		 * Attempt to add a report type whose service type or message type is not covered by the forwarding filter of
+		 * the Application Process configuration (ST[14])
+		 */
+		ReportTypeNotForwardable = 52,
+		/**
+		 * Attempt to delete a report type, housekeeping structure or event definition, that is not in the
+		 * forward-control configuration (ST[14])
+		 */
+		NonExistentForwardControlDefinition = 53,
+		/**
+		 * Attempt to block the reports of an event definition ID that does not exist (ST[14])
+		 */
+		InvalidEventDefinitionID = 54,
+		/**
+		 * Attempt to forward the reports of a housekeeping structure ID that does not exist (ST[14])
+		 */
+		InvalidHousekeepingStructureID = 55,
+		/**
+		 * Attempt to add housekeeping structures or event definitions for a new application process, when the max
+		 * number of application processes in the forward-control configuration is already reached (ST[14])
+		 */
+		MaxForwardControlApplicationsReached = 56,
+		/**
+		 * Attempt to add an expected value check definition for a parameter that is not of an integer type, whose
+		 * value cannot be masked (ST[12])
+		 */
+		ExpectedValueCheckOfNonIntegerParameter = 57,
 	};
 
 	/**
@@ -0,0 +1,127 @@
+#ifndef ECSS_SERVICES_ACTIVITYGROUPS_HPP
+#define ECSS_SERVICES_ACTIVITYGROUPS_HPP
+
+#include <cstdint>
+#include "etl/array.h"
+#include "etl/bitset.h"
+
+/**
+ * The groups of the activities of a time-based schedule, and the status of each group.
+ *
+ * Each activity is identified by the slot where it is stored in the schedule, see \ref ActivitySchedule. The members
+ * of each group are kept in a doubly linked list whose links are stored in arrays indexed by slot, so adding or
+ * removing an activity is O(1), and the activities of a group are visited without scanning the whole schedule.
+ *
+ * A group is enabled or disabled by changing a single flag, regardless of the number of its activities. The
+ * executor of the schedule checks the flag when an activity is due.
+ *
+ * @tparam Capacity The max number of activities, i.e. the number of slots of the schedule
+ * @tparam Groups The number of groups. Valid group IDs range from 0 to `Groups - 1`.
+ */
+template <uint16_t Capacity, uint8_t Groups>
+class ActivityGroups {
+public:
+	using Slot = uint16_t;
+
+private:
+	static constexpr Slot NoSlot = UINT16_MAX;
+
+	etl::bitset<Groups> enabledGroups;
+	etl::array<Slot, Groups> firstSlots;
+	etl::array<uint16_t, Groups> groupSizes;
+
+	etl::array<uint8_t, Capacity> groupOfSlot;
+	etl::array<Slot, Capacity> nextSlots;
+	etl::array<Slot, Capacity> previousSlots;
+
+public:
+	ActivityGroups() {
+		reset();
+	}
+
+	static bool isValid(uint8_t groupID) {
+		return groupID < Groups;
+	}
+
+	/**
+	 * Removes all activities from all groups, and enables all groups
+	 */
+	void reset() {
+		enabledGroups.set();
+		firstSlots.fill(NoSlot);
+		groupSizes.fill(0);
+	}
+
+	bool isEnabled(uint8_t groupID) const {
+		return enabledGroups[groupID];
+	}
+
+	void setEnabled(uint8_t groupID, bool enabled) {
+		enabledGroups[groupID] = enabled;
+	}
+
+	void setAllEnabled(bool enabled) {
+		if (enabled) {
+			enabledGroups.set();
+		} else {
+			enabledGroups.reset();
+		}
+	}
+
+	/**
+	 * @return The number of activities of a group
+	 */
+	uint16_t size(uint8_t groupID) const {
+		return groupSizes[groupID];
+	}
+
+	uint8_t groupOf(Slot slot) const {
+		return groupOfSlot[slot];
+	}
+
+	/**
+	 * Adds the activity stored in \p slot to a group. The activity must not already be in a group.
+	 */
+	void add(Slot slot, uint8_t groupID) {
+		groupOfSlot[slot] = groupID;
+		previousSlots[slot] = NoSlot;
+		nextSlots[slot] = firstSlots[groupID];
+		if (firstSlots[groupID] != NoSlot) {
+			previousSlots[firstSlots[groupID]] = slot;
+		}
+		firstSlots[groupID] = slot;
+		groupSizes[groupID]++;
+	}
+
+	/**
+	 * Removes the activity stored in \p slot from its group
+	 */
+	void remove(Slot slot) {
+		uint8_t groupID = groupOfSlot[slot];
+		if (previousSlots[slot] != NoSlot) {
+			nextSlots[previousSlots[slot]] = nextSlots[slot];
+		} else {
+			firstSlots[groupID] = nextSlots[slot];
+		}
+		if (nextSlots[slot] != NoSlot) {
+			previousSlots[nextSlots[slot]] = previousSlots[slot];
+		}
+		groupSizes[groupID]--;
+	}
+
+	/**
+	 * Calls \p function with the slot of every activity of a group, in no particular order. The function may remove
+	 * the activity it is called for.
+	 */
+	template <typename Function>
+	void forEachSlot(uint8_t groupID, Function function) {
+		Slot slot = firstSlots[groupID];
+		while (slot != NoSlot) {
+			Slot next = nextSlots[slot];
+			function(slot);
+			slot = next;
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_ACTIVITYGROUPS_HPP
@@ -0,0 +1,338 @@
+#ifndef ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
+#define ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "etl/array.h"
+#include "etl/vector.h"
+
+/**
+ * Fixed-capacity storage for the activities of a time-based schedule, indexed both by release time and by request ID.
+ *
+ * The activities are stored in slots that never move, so a pointer to an activity stays valid until that activity is
+ * removed. Two indices refer to the slots:
+ * - a binary min-heap, ordered by release time and then by order of insertion, so that the earliest activity is
+ *   found in O(1), and an activity is inserted, removed or given a new release time in O(log n)
+ * - an open-addressing hash table with linear probing, keyed by request ID, so that an activity is found in O(1)
+ *   expected time
+ *
+ * Request IDs do not need to be unique. If several activities have the same ID, \ref find() returns the earliest one.
+ *
+ * @tparam Activity The type of the activities. It has a `requestID` member with a `hash()` function and an equality
+ * operator, and a `requestReleaseTime` member with a less-than and an equality operator.
+ * @tparam Capacity The max number of activities
+ */
+template <typename Activity, uint16_t Capacity>
+class ActivitySchedule {
+public:
+	using Slot = uint16_t;
+
+private:
+	static constexpr Slot NoSlot = UINT16_MAX;
+
+	/**
+	 * The number of entries of the hash table, a power of two that keeps the table at most half full
+	 */
+	static constexpr uint32_t TableSize = [] {
+		uint32_t size = 1;
+		while (size < 2U * Capacity) {
+			size *= 2;
+		}
+		return size;
+	}();
+
+	etl::array<Activity, Capacity> activities;
+
+	/**
+	 * The order in which each slot was filled, used to keep activities with the same release time in order of
+	 * insertion
+	 */
+	etl::array<uint32_t, Capacity> insertionOrder;
+	uint32_t nextInsertion = 0;
+
+	/**
+	 * The position of each slot in \ref heap
+	 */
+	etl::array<uint16_t, Capacity> heapPositions;
+
+	/**
+	 * The occupied slots, as a min-heap ordered by \ref isBefore()
+	 */
+	etl::vector<Slot, Capacity> heap;
+
+	etl::vector<Slot, Capacity> freeSlots;
+
+	/**
+	 * The occupied slots, stored at the position given by the hash of their request ID, or at the next free position
+	 */
+	etl::array<Slot, TableSize> table;
+
+	/**
+	 * Scratch space for \ref forEachInOrder()
+	 */
+	etl::vector<uint16_t, Capacity> traversalFrontier;
+
+	template <typename Key>
+	static uint32_t homePosition(const Key& requestID) {
+		return requestID.hash() & (TableSize - 1);
+	}
+
+	void setHeapEntry(uint16_t position, Slot slot) {
+		heap[position] = slot;
+		heapPositions[slot] = position;
+	}
+
+	void siftUp(uint16_t position) {
+		Slot slot = heap[position];
+		while (position > 0) {
+			uint16_t parent = (position - 1) / 2;
+			if (not isBefore(slot, heap[parent])) {
+				break;
+			}
+			setHeapEntry(position, heap[parent]);
+			position = parent;
+		}
+		setHeapEntry(position, slot);
+	}
+
+	void siftDown(uint16_t position) {
+		Slot slot = heap[position];
+		uint16_t size = heap.size();
+		while (true) {
+			uint16_t child = 2 * position + 1;
+			if (child >= size) {
+				break;
+			}
+			if (child + 1 < size and isBefore(heap[child + 1], heap[child])) {
+				child++;
+			}
+			if (not isBefore(heap[child], slot)) {
+				break;
+			}
+			setHeapEntry(position, heap[child]);
+			position = child;
+		}
+		setHeapEntry(position, slot);
+	}
+
+	void addToTable(Slot slot) {
+		uint32_t position = homePosition(activities[slot].requestID);
+		while (table[position] != NoSlot) {
+			position = (position + 1) & (TableSize - 1);
+		}
+		table[position] = slot;
+	}
+
+	/**
+	 * Removes a slot from the hash table, moving back the entries that follow it, so that no probe sequence is broken
+	 */
+	void removeFromTable(Slot slot) {
+		uint32_t position = homePosition(activities[slot].requestID);
+		while (table[position] != slot) {
+			position = (position + 1) & (TableSize - 1);
+		}
+
+		uint32_t next = position;
+		while (true) {
+			table[position] = NoSlot;
+			while (true) {
+				next = (next + 1) & (TableSize - 1);
+				if (table[next] == NoSlot) {
+					return;
+				}
+				// The entry at next can stay there, if its home position is cyclically in (position, next]
+				uint32_t home = homePosition(activities[table[next]].requestID);
+				bool staysInPlace = (position <= next) ? (position < home and home <= next)
+				                                       : (position < home or home <= next);
+				if (not staysInPlace) {
+					break;
+				}
+			}
+			table[position] = table[next];
+			position = next;
+		}
+	}
+
+public:
+	ActivitySchedule() {
+		clear();
+	}
+
+	uint16_t size() const {
+		return heap.size();
+	}
+
+	bool empty() const {
+		return heap.empty();
+	}
+
+	bool full() const {
+		return heap.full();
+	}
+
+	uint16_t available() const {
+		return Capacity - heap.size();
+	}
+
+	void clear() {
+		heap.clear();
+		freeSlots.clear();
+		for (Slot slot = Capacity; slot > 0; slot--) {
+			freeSlots.push_back(slot - 1);
+		}
+		table.fill(NoSlot);
+	}
+
+	/**
+	 * @return True if the activity in slot \p first is released before the activity in slot \p second
+	 */
+	bool isBefore(Slot first, Slot second) const {
+		const auto& firstTime = activities[first].requestReleaseTime;
+		const auto& secondTime = activities[second].requestReleaseTime;
+		if (firstTime == secondTime) {
+			return insertionOrder[first] < insertionOrder[second];
+		}
+		return firstTime < secondTime;
+	}
+
+	/**
+	 * Adds a copy of an activity
+	 *
+	 * @return The stored activity, or nullptr if the schedule is full
+	 */
+	Activity* insert(const Activity& activity) {
+		if (full()) {
+			return nullptr;
+		}
+
+		Slot slot = freeSlots.back();
+		freeSlots.pop_back();
+		activities[slot] = activity;
+		insertionOrder[slot] = nextInsertion++;
+
+		addToTable(slot);
+		heap.push_back(slot);
+		siftUp(heap.size() - 1);
+		return &activities[slot];
+	}
+
+	/**
+	 * @return The earliest activity with the given request ID, or nullptr if there is none
+	 */
+	template <typename Key>
+	Activity* find(const Key& requestID) {
+		Slot found = NoSlot;
+		for (uint32_t position = homePosition(requestID); table[position] != NoSlot;
+		     position = (position + 1) & (TableSize - 1)) {
+			Slot slot = table[position];
+			if (activities[slot].requestID == requestID and (found == NoSlot or isBefore(slot, found))) {
+				found = slot;
+			}
+		}
+		return (found == NoSlot) ? nullptr : &activities[found];
+	}
+
+	/**
+	 * Removes an activity. It must be one of the activities stored in this schedule.
+	 */
+	void erase(const Activity& activity) {
+		Slot slot = slotOf(activity);
+		removeFromTable(slot);
+
+		uint16_t position = heapPositions[slot];
+		Slot last = heap.back();
+		heap.pop_back();
+		if (last != slot) {
+			setHeapEntry(position, last);
+			siftUp(position);
+			siftDown(heapPositions[last]);
+		}
+		freeSlots.push_back(slot);
+	}
+
+	/**
+	 * Changes the release time of an activity, moving it to its new place in the release order
+	 */
+	template <typename Time>
+	void setReleaseTime(Activity& activity, const Time& releaseTime) {
+		Slot slot = slotOf(activity);
+		activity.requestReleaseTime = releaseTime;
+		siftUp(heapPositions[slot]);
+		siftDown(heapPositions[slot]);
+	}
+
+	/**
+	 * Changes the request ID of an activity, updating the index of the IDs
+	 */
+	template <typename Key>
+	void setRequestID(Activity& activity, const Key& requestID) {
+		Slot slot = slotOf(activity);
+		removeFromTable(slot);
+		activity.requestID = requestID;
+		addToTable(slot);
+	}
+
+	/**
+	 * @return The activity that is released first. The schedule must not be empty.
+	 */
+	Activity& front() {
+		return activities[heap.front()];
+	}
+
+	/**
+	 * Removes the activity that is released first. The schedule must not be empty.
+	 */
+	void pop_front() {
+		erase(front());
+	}
+
+	Slot slotOf(const Activity& activity) const {
+		return &activity - activities.data();
+	}
+
+	Activity& operator[](Slot slot) {
+		return activities[slot];
+	}
+
+	/**
+	 * Calls \p function for every activity, in no particular order. The function must not add or remove activities,
+	 * or change their release time.
+	 */
+	template <typename Function>
+	void forEach(Function function) {
+		for (Slot slot: heap) {
+			function(activities[slot]);
+		}
+	}
+
+	/**
+	 * Calls \p function for every activity, in release order, without sorting the activities. The next activity is
+	 * always the earliest child, in the heap, of the activities that have already been visited. The function must not
+	 * add or remove activities, or change their release time.
+	 */
+	template <typename Function>
+	void forEachInOrder(Function function) {
+		if (heap.empty()) {
+			return;
+		}
+
+		// A min-heap of positions in the heap, ordered by the activities at these positions
+		auto isLater = [this](uint16_t first, uint16_t second) { return isBefore(heap[second], heap[first]); };
+		traversalFrontier.clear();
+		traversalFrontier.push_back(0);
+		while (not traversalFrontier.empty()) {
+			std::pop_heap(traversalFrontier.begin(), traversalFrontier.end(), isLater);
+			uint16_t position = traversalFrontier.back();
+			traversalFrontier.pop_back();
+
+			function(activities[heap[position]]);
+
+			for (uint16_t child = 2 * position + 1; child <= 2 * position + 2 and child < heap.size(); child++) {
+				traversalFrontier.push_back(child);
+				std::push_heap(traversalFrontier.begin(), traversalFrontier.end(), isLater);
+			}
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
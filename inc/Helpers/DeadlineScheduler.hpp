@@ -0,0 +1,150 @@
+#ifndef ECSS_SERVICES_DEADLINESCHEDULER_HPP
+#define ECSS_SERVICES_DEADLINESCHEDULER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include "ErrorHandler.hpp"
+#include "etl/vector.h"
+
+/**
+ * A queue of periodic jobs, ordered by the time at which each of them is next due.
+ *
+ * Each job is identified by a 16-bit key (e.g. a parameter ID) and has a deadline in milliseconds. The jobs are kept
+ * in a binary min-heap, so finding the earliest deadline is O(1), and running a due job and rescheduling it is
+ * O(log n). A caller that runs periodically only visits the jobs that are actually due, instead of checking every job
+ * on every tick.
+ *
+ * Time is a free-running 32-bit millisecond counter, as used by \ref HousekeepingService::reportPendingStructures().
+ * Deadlines are compared relative to each other, so the counter may wrap around, as long as all deadlines stay within
+ * 2^31 ms (about 24 days) of the current time.
+ *
+ * @tparam Capacity The maximum number of jobs
+ */
+template <uint16_t Capacity>
+class DeadlineScheduler {
+public:
+	struct Job {
+		uint32_t deadline;
+		uint16_t key;
+	};
+
+private:
+	etl::vector<Job, Capacity> heap;
+
+	/**
+	 * @return True if \p first is due before \p second, taking wrap-around of the time counter into account
+	 */
+	inline static bool isBefore(uint32_t first, uint32_t second) {
+		return static_cast<int32_t>(first - second) < 0;
+	}
+
+	/**
+	 * Heap comparator, which keeps the job with the earliest deadline at the front
+	 */
+	inline static bool isLater(const Job& first, const Job& second) {
+		return isBefore(second.deadline, first.deadline);
+	}
+
+public:
+	/**
+	 * @return True if a job with the given \p deadline should run at \p currentTime
+	 */
+	inline static bool isDue(uint32_t deadline, uint32_t currentTime) {
+		return not isBefore(currentTime, deadline);
+	}
+
+	/**
+	 * Calculates the deadline that follows \p deadline for a job that runs every \p period ms. If the job is late by
+	 * more than a period, the missed periods are skipped instead of being run in a burst.
+	 */
+	inline static uint32_t nextPeriodicDeadline(uint32_t deadline, uint32_t period, uint32_t currentTime) {
+		uint32_t next = deadline + period;
+		if (isDue(next, currentTime)) {
+			next = currentTime + period;
+		}
+		return next;
+	}
+
+	/**
+	 * Adds a job. If a job with the same key already exists, its deadline is replaced.
+	 *
+	 * @return False if the scheduler is full
+	 */
+	bool schedule(uint16_t key, uint32_t deadline) {
+		cancel(key);
+		if (heap.full()) {
+			ErrorHandler::reportInternalError(ErrorHandler::MapFull);
+			return false;
+		}
+
+		heap.push_back({deadline, key});
+		std::push_heap(heap.begin(), heap.end(), isLater);
+		return true;
+	}
+
+	/**
+	 * Removes the job with the given key, if it exists.
+	 *
+	 * @note This is O(n), since it is only meant for rare changes of the job set, such as deleting a definition
+	 */
+	void cancel(uint16_t key) {
+		auto job = std::find_if(heap.begin(), heap.end(), [key](const Job& job) { return job.key == key; });
+		if (job == heap.end()) {
+			return;
+		}
+
+		*job = heap.back();
+		heap.pop_back();
+		std::make_heap(heap.begin(), heap.end(), isLater);
+	}
+
+	/**
+	 * Removes all jobs
+	 */
+	void clear() {
+		heap.clear();
+	}
+
+	/**
+	 * @return The number of scheduled jobs
+	 */
+	size_t size() const {
+		return heap.size();
+	}
+
+	/**
+	 * @return The earliest deadline of all jobs, or nothing if there are no jobs
+	 */
+	std::optional<uint32_t> nextDeadline() const {
+		if (heap.empty()) {
+			return {};
+		}
+		return heap.front().deadline;
+	}
+
+	/**
+	 * Runs every job whose deadline is not after \p currentTime, in order of deadline.
+	 *
+	 * @param runner A function that receives a due \ref Job and returns the next deadline of the job, or nothing if the
+	 * job should be removed. If the returned deadline is not after \p currentTime, the job is run again in the same
+	 * call, so callers that want to skip missed periods must return a deadline in the future.
+	 */
+	template <typename Runner>
+	void runDueJobs(uint32_t currentTime, Runner&& runner) {
+		while (not heap.empty() and isDue(heap.front().deadline, currentTime)) {
+			std::pop_heap(heap.begin(), heap.end(), isLater);
+			Job job = heap.back();
+
+			std::optional<uint32_t> nextDeadline = runner(job);
+			if (nextDeadline) {
+				heap.back().deadline = *nextDeadline;
+				std::push_heap(heap.begin(), heap.end(), isLater);
+			} else {
+				heap.pop_back();
+			}
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_DEADLINESCHEDULER_HPP
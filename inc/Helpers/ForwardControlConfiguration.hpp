@@ -1,9 +1,12 @@
 #ifndef ECSS_SERVICES_FORWARDCONTROLCONFIGURATION_HPP
 #define ECSS_SERVICES_FORWARDCONTROLCONFIGURATION_HPP
 
+#include <algorithm>
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
 #include "Helpers/Parameter.hpp"
+#include "etl/array.h"
+#include "etl/bitset.h"
 #include "etl/map.h"
 #include "etl/vector.h"
 
@@ -11,6 +14,10 @@
  * The Application Process configuration. It's basically a map, storing a vector of report type definitions for each
  * pair of (applicationID, serviceType). It contains definitions, which indicate whether a telemetry message, produced
  * by a service, inside an application process (subsystem), should be forwarded to the ground station.
+ *
+ * The definitions are also compiled into a forwarding filter, which has one bit for every (applicationID, serviceType,
+ * messageType) triplet. The filter is updated along with the definitions, so that checking whether a report is
+ * forwarded only takes a bit lookup, no matter how many definitions exist.
  */
 class ApplicationProcessConfiguration {
 public:
@@ -41,7 +48,307 @@ public:
 	 */
 	etl::map<AppServiceKey, ReportTypeDefinitions, ECSSMaxApplicationsServicesCombinations> definitions;
 
+	/**
+	 * The number of bits of the forwarding filter that belong to each application process
+	 */
+	static constexpr uint16_t ReportTypesPerApplication =
+	    static_cast<uint16_t>(ECSSForwardingFilterServiceTypes) * ECSSForwardingFilterMessageTypes;
+
+private:
+	/**
+	 * The application processes that have bits in the \ref forwardingFilter, in the order of their bits
+	 */
+	etl::vector<uint8_t, ECSSMaxControlledApplicationProcesses> filterApplications;
+
+	/**
+	 * The compiled \ref definitions. A bit is set if the report type of its triplet is forwarded.
+	 */
+	etl::bitset<ECSSMaxControlledApplicationProcesses * ReportTypesPerApplication> forwardingFilter;
+
+	/**
+	 * @return The index of the application process in \ref filterApplications, or its size if the application
+	 * process has no bits in the filter
+	 */
+	uint8_t filterIndexOf(uint16_t applicationID) const {
+		uint8_t index = 0;
+		while (index < filterApplications.size() and filterApplications[index] != applicationID) {
+			index++;
+		}
+		return index;
+	}
+
+	static uint16_t filterBit(uint8_t filterIndex, uint8_t serviceType, uint8_t messageType) {
+		return filterIndex * ReportTypesPerApplication + serviceType * ECSSForwardingFilterMessageTypes + messageType;
+	}
+
+public:
 	ApplicationProcessConfiguration() = default;
+
+	/**
+	 * @return True if the report type has a bit in the forwarding filter, i.e. if it can ever be forwarded
+	 */
+	static bool isForwardable(uint8_t serviceType, uint8_t messageType) {
+		return serviceType < ECSSForwardingFilterServiceTypes and messageType < ECSSForwardingFilterMessageTypes;
+	}
+
+	/**
+	 * Adds a report type definition, unless it already exists, and sets its bit in the forwarding filter. The
+	 * definitions should only be added through this function, so that the filter stays in sync with them.
+	 *
+	 * @return False if the report type is not forwardable, or if the max number of application processes already
+	 * have bits in the filter. Nothing is added in that case.
+	 */
+	bool addReportType(uint8_t applicationID, uint8_t serviceType, uint8_t messageType) {
+		if (not isForwardable(serviceType, messageType)) {
+			return false;
+		}
+
+		uint8_t filterIndex = filterIndexOf(applicationID);
+		if (filterIndex == filterApplications.size()) {
+			if (filterApplications.full()) {
+				return false;
+			}
+			filterApplications.push_back(applicationID);
+		}
+
+		uint16_t bit = filterBit(filterIndex, serviceType, messageType);
+		if (not forwardingFilter.test(bit)) {
+			definitions[std::make_pair(applicationID, serviceType)].push_back(messageType);
+			forwardingFilter.set(bit);
+		}
+		return true;
+	}
+
+	/**
+	 * @return True if the report type is defined for the application process, and its reports are therefore
+	 * forwarded to the ground station
+	 */
+	bool isReportTypeForwarded(uint16_t applicationID, uint8_t serviceType, uint8_t messageType) const {
+		if (not isForwardable(serviceType, messageType)) {
+			return false;
+		}
+
+		uint8_t filterIndex = filterIndexOf(applicationID);
+		return filterIndex < filterApplications.size() and
+		       forwardingFilter.test(filterBit(filterIndex, serviceType, messageType));
+	}
+
+	/**
+	 * Removes a report type definition, and clears its bit in the forwarding filter. The service type definition is
+	 * removed along with its last report type.
+	 *
+	 * @return False if the report type is not defined
+	 */
+	bool removeReportType(uint8_t applicationID, uint8_t serviceType, uint8_t messageType) {
+		if (not isReportTypeForwarded(applicationID, serviceType, messageType)) {
+			return false;
+		}
+
+		auto definition = definitions.find(std::make_pair(applicationID, serviceType));
+		if (definition != definitions.end()) {
+			auto& messageTypes = definition->second;
+			messageTypes.erase(std::remove(messageTypes.begin(), messageTypes.end(), messageType), messageTypes.end());
+			if (messageTypes.empty()) {
+				definitions.erase(definition);
+			}
+		}
+
+		forwardingFilter.reset(filterBit(filterIndexOf(applicationID), serviceType, messageType));
+		return true;
+	}
+
+	/**
+	 * Removes a service type definition with all of its report types
+	 *
+	 * @return False if the service type is not defined
+	 */
+	bool removeServiceType(uint8_t applicationID, uint8_t serviceType) {
+		auto definition = definitions.find(std::make_pair(applicationID, serviceType));
+		if (definition == definitions.end()) {
+			return false;
+		}
+
+		uint8_t filterIndex = filterIndexOf(applicationID);
+		for (auto messageType: definition->second) {
+			forwardingFilter.reset(filterBit(filterIndex, serviceType, messageType));
+		}
+		definitions.erase(definition);
+		return true;
+	}
+
+	/**
+	 * Removes all the service type definitions of an application process
+	 *
+	 * @return False if the application process has no definitions
+	 */
+	bool removeApplication(uint8_t applicationID) {
+		auto first = definitions.lower_bound(std::make_pair(applicationID, static_cast<uint8_t>(0)));
+		if (first == definitions.end() or first->first.first != applicationID) {
+			return false;
+		}
+
+		while (first != definitions.end() and first->first.first == applicationID) {
+			removeServiceType(applicationID, (first++)->first.second);
+		}
+		return true;
+	}
+
+	/**
+	 * Removes all the definitions, so that no report type is forwarded
+	 */
+	void clear() {
+		definitions.clear();
+		filterApplications.clear();
+		forwardingFilter.reset();
+	}
 };
 
+/**
+ * A forward-control configuration that contains a set of identifiers for each application process, such as the
+ * housekeeping structures whose reports are forwarded, or the event definitions whose reports are blocked.
+ *
+ * Each application process gets a bitset with one bit per identifier, the first time one of its identifiers is added,
+ * so that checking whether an identifier is in the configuration only takes a bit lookup.
+ *
+ * @tparam Identifier The type of the identifiers, as appended to messages
+ * @tparam IdentifierCount The number of identifiers. Valid identifiers range from 0 to `IdentifierCount - 1`.
+ */
+template <typename Identifier, uint16_t IdentifierCount>
+class ForwardControlIdentifiers {
+public:
+	typedef etl::bitset<IdentifierCount> IdentifierSet;
+
+private:
+	/**
+	 * The application processes that have a set in \ref identifiers, in the order of their sets
+	 */
+	etl::vector<uint8_t, ECSSMaxControlledApplicationProcesses> applications;
+
+	etl::array<IdentifierSet, ECSSMaxControlledApplicationProcesses> identifiers;
+
+	/**
+	 * @return The index of the application process in \ref applications, or its size if the application process
+	 * has no set of identifiers
+	 */
+	uint8_t indexOf(uint16_t applicationID) const {
+		uint8_t index = 0;
+		while (index < applications.size() and applications[index] != applicationID) {
+			index++;
+		}
+		return index;
+	}
+
+	/**
+	 * @return The set of identifiers of the application process, or nullptr if there is no space for a new one
+	 */
+	IdentifierSet* findOrAdd(uint8_t applicationID) {
+		uint8_t index = indexOf(applicationID);
+		if (index == applications.size()) {
+			if (applications.full()) {
+				return nullptr;
+			}
+			applications.push_back(applicationID);
+			identifiers[index].reset();
+		}
+		return &identifiers[index];
+	}
+
+public:
+	/**
+	 * @return The number of application processes that have, or used to have, identifiers in the configuration
+	 */
+	uint8_t size() const {
+		return applications.size();
+	}
+
+	uint8_t applicationAt(uint8_t index) const {
+		return applications[index];
+	}
+
+	const IdentifierSet& identifiersAt(uint8_t index) const {
+		return identifiers[index];
+	}
+
+	/**
+	 * @return True if the application process has a set of identifiers, or if there is space for a new one
+	 */
+	bool hasSpaceFor(uint8_t applicationID) const {
+		return indexOf(applicationID) < applications.size() or not applications.full();
+	}
+
+	/**
+	 * @return False if the identifier is invalid, or if the max number of application processes already have
+	 * identifiers in the configuration
+	 */
+	bool add(uint8_t applicationID, uint16_t identifier) {
+		IdentifierSet* set = (identifier < IdentifierCount) ? findOrAdd(applicationID) : nullptr;
+		if (set == nullptr) {
+			return false;
+		}
+		set->set(identifier);
+		return true;
+	}
+
+	/**
+	 * Adds all the valid identifiers of an application process
+	 */
+	bool addAll(uint8_t applicationID) {
+		IdentifierSet* set = findOrAdd(applicationID);
+		if (set == nullptr) {
+			return false;
+		}
+		set->set();
+		return true;
+	}
+
+	/**
+	 * @return False if the identifier is not in the configuration
+	 */
+	bool remove(uint8_t applicationID, uint16_t identifier) {
+		if (not contains(applicationID, identifier)) {
+			return false;
+		}
+		identifiers[indexOf(applicationID)].reset(identifier);
+		return true;
+	}
+
+	/**
+	 * Removes all the identifiers of an application process
+	 *
+	 * @return False if the application process has no identifiers
+	 */
+	bool removeAll(uint8_t applicationID) {
+		uint8_t index = indexOf(applicationID);
+		if (index == applications.size() or identifiers[index].none()) {
+			return false;
+		}
+		identifiers[index].reset();
+		return true;
+	}
+
+	bool contains(uint16_t applicationID, uint16_t identifier) const {
+		if (identifier >= IdentifierCount) {
+			return false;
+		}
+		uint8_t index = indexOf(applicationID);
+		return index < applications.size() and identifiers[index].test(identifier);
+	}
+
+	void clear() {
+		applications.clear();
+	}
+};
+
+/**
+ * The Housekeeping Parameter Report configuration. It contains the housekeeping structures, per application process,
+ * whose housekeeping parameter reports are forwarded to the ground station.
+ */
+typedef ForwardControlIdentifiers<uint8_t, UINT8_MAX + 1> HousekeepingReportConfiguration;
+
+/**
+ * The Event Report Blocking configuration. It contains the event definitions, per application process, whose event
+ * reports are not forwarded to the ground station.
+ */
+typedef ForwardControlIdentifiers<uint16_t, ECSSEventDefinitionCount> EventReportBlockingConfiguration;
+
 #endif
@@ -1,6 +1,7 @@
 #ifndef ECSS_SERVICES_PMONBASE_HPP
 #define ECSS_SERVICES_PMONBASE_HPP
 #include <cstdint>
+#include <optional>
 #include "Message.hpp"
 #include "etl/array.h"
 #include "Service.hpp"
@@ -27,9 +28,19 @@ public:
 		AboveHighThreshold = 10
 	};
 
+	/**
+	 * The type of check performed by a definition, used to group definitions of the same type during evaluation
+	 */
+	enum CheckType : uint8_t {
+		ExpectedValueCheck = 0,
+		LimitCheck = 1,
+		DeltaCheck = 2
+	};
+
 	uint16_t monitoredParameterId;
 
-	std::reference_wrapper<ParameterBase> monitoredParameter;
+	CheckType checkType;
+
 	/**
 	 * The number of checks that need to be conducted in order to set a new Parameter Monitoring Status.
 	 */
@@ -40,13 +51,65 @@ public:
 	uint16_t repetitionCounter = 0;
 	bool monitoringEnabled = false;
 	CheckingStatus checkingStatus = Unchecked;
+	/**
+	 * The result of the latest checks, which becomes the new \ref checkingStatus once it has been repeated
+	 * \ref repetitionNumber times in a row
+	 */
+	CheckingStatus pendingCheckingStatus = Unchecked;
+	/**
+	 * The previous and the current checking status of the latest transition
+	 */
 	etl::array<CheckingStatus, 2> checkTransitionList = {};
 
+	/**
+	 * The value of \ref outOfLimitsIndex for definitions that are not out of limits
+	 */
+	inline static constexpr uint16_t NotOutOfLimits = UINT16_MAX;
+
+	/**
+	 * The position of the definition in the out-of-limits list of the \ref OnBoardMonitoringService, maintained by
+	 * the service
+	 */
+	uint16_t outOfLimitsIndex = NotOutOfLimits;
+
+	/**
+	 * @return True if \p status is one of the statuses reported in an out-of-limits report, i.e. an unexpected value,
+	 * or a value or delta beyond its limits
+	 */
+	static bool isOutOfLimits(CheckingStatus status) {
+		return status == UnexpectedValue or status == BelowLowLimit or status == AboveHighLimit or
+		       status == BelowLowThreshold or status == AboveHighThreshold;
+	}
+
+	/**
+	 * @return True if the definition has been checked, and no change of checking status is pending. Checking it again
+	 * with the same result would then change nothing.
+	 */
+	bool isSettled() const {
+		return checkingStatus != Unchecked and pendingCheckingStatus == checkingStatus;
+	}
+
+	/**
+	 * Applies the result of a single check, following the repetition rules of ECSS-E-ST-70-41C 5.4.2.3. The checking
+	 * status only changes once the same result has been obtained \ref repetitionNumber consecutive times.
+	 *
+	 * @return True if the checking status changed, in which case \ref checkTransitionList holds the transition
+	 */
+	bool applyCheckResult(CheckingStatus result);
+
+	/**
+	 * Discards the results and samples collected by the checks of the definition so far, i.e. the pending checking
+	 * status and its repetitions, and the deltas of a delta check. This is done whenever the definition is enabled or
+	 * disabled, so that its next checks do not combine samples from before and after the change.
+	 */
+	void restartChecks();
+
 protected:
 	/**
-	 * @param monitoredParameterId is assumed to be correct and not checked.
+	 * @param monitoredParameterId The parameter is looked up on every check, so it does not need to exist when the
+	 * definition is created. A check of a missing parameter results in an \ref Invalid status.
 	 */
-	PMONBase(uint16_t monitoredParameterId, uint16_t repetitionNumber);
+	PMONBase(uint16_t monitoredParameterId, uint16_t repetitionNumber, CheckType checkType);
 };
 
 /**
@@ -54,14 +117,45 @@ protected:
  */
 class PMONExpectedValueCheck : public PMONBase {
 public:
-	double expectedValue;
+	/**
+	 * The value that the monitored parameter must have after applying the \ref mask. The parameter must be of an
+	 * integer type.
+	 */
+	uint64_t expectedValue;
 	uint64_t mask;
 	uint16_t unexpectedValueEvent;
 
-	explicit PMONExpectedValueCheck(uint16_t monitoredParameterId, uint16_t repetitionNumber, double expectedValue,
+	explicit PMONExpectedValueCheck(uint16_t monitoredParameterId, uint16_t repetitionNumber, uint64_t expectedValue,
 	                                uint64_t mask, uint16_t unexpectedValueEvent)
 	    : expectedValue(expectedValue), mask(mask), unexpectedValueEvent(unexpectedValueEvent),
-	      PMONBase(monitoredParameterId, repetitionNumber){};
+	      PMONBase(monitoredParameterId, repetitionNumber, ExpectedValueCheck){};
+
+	/**
+	 * Checks a batch of values against their expected values, after applying the masks
+	 */
+	static void evaluate(const uint64_t* values, const uint64_t* masks, const uint64_t* expectedValues,
+	                     CheckingStatus* results, uint16_t count) {
+		for (uint16_t i = 0; i < count; i++) {
+			results[i] = ((values[i] & masks[i]) == expectedValues[i]) ? ExpectedValue : UnexpectedValue;
+		}
+	}
+
+	/**
+	 * @return The event to raise when the checking status becomes \p status, if any
+	 */
+	std::optional<uint16_t> eventOf(CheckingStatus status) const {
+		if (status == UnexpectedValue) {
+			return unexpectedValueEvent;
+		}
+		return {};
+	}
+
+	/**
+	 * @return The value reported in a check transition, which is the expected value for this check type
+	 */
+	double crossedLimitOf(CheckingStatus /* previousStatus */, CheckingStatus /* currentStatus */) const {
+		return static_cast<double>(expectedValue);
+	}
 };
 
 /**
@@ -77,7 +171,42 @@ public:
 	explicit PMONLimitCheck(uint16_t monitoredParameterId, uint16_t repetitionNumber, double lowLimit,
 	                        uint16_t belowLowLimitEvent, double highLimit, uint16_t aboveHighLimitEvent)
 	    : lowLimit(lowLimit), belowLowLimitEvent(belowLowLimitEvent), highLimit(highLimit),
-	      aboveHighLimitEvent(aboveHighLimitEvent), PMONBase(monitoredParameterId, repetitionNumber){};
+	      aboveHighLimitEvent(aboveHighLimitEvent), PMONBase(monitoredParameterId, repetitionNumber, LimitCheck){};
+
+	/**
+	 * Checks a batch of values against their limits
+	 */
+	static void evaluate(const double* values, const double* lowLimits, const double* highLimits,
+	                     CheckingStatus* results, uint16_t count) {
+		for (uint16_t i = 0; i < count; i++) {
+			CheckingStatus aboveOrWithin = (values[i] > highLimits[i]) ? AboveHighLimit : WithinLimits;
+			results[i] = (values[i] < lowLimits[i]) ? BelowLowLimit : aboveOrWithin;
+		}
+	}
+
+	/**
+	 * @return The event to raise when the checking status becomes \p status, if any
+	 */
+	std::optional<uint16_t> eventOf(CheckingStatus status) const {
+		if (status == BelowLowLimit) {
+			return belowLowLimitEvent;
+		}
+		if (status == AboveHighLimit) {
+			return aboveHighLimitEvent;
+		}
+		return {};
+	}
+
+	/**
+	 * @return The limit crossed by a check transition, i.e. the low limit if the parameter went below or came back
+	 * from below it, and the high limit otherwise
+	 */
+	double crossedLimitOf(CheckingStatus previousStatus, CheckingStatus currentStatus) const {
+		if (previousStatus == BelowLowLimit or currentStatus == BelowLowLimit) {
+			return lowLimit;
+		}
+		return highLimit;
+	}
 };
 
 /**
@@ -91,12 +220,79 @@ public:
 	double highDeltaThreshold;
 	uint16_t aboveHighThresholdEvent;
 
+	/**
+	 * The latest sampled value of the monitored parameter, if \ref hasPreviousValue is set
+	 */
+	double previousValue = 0;
+	bool hasPreviousValue = false;
+	/**
+	 * The sum of the deltas collected since the latest check
+	 */
+	double deltaSum = 0;
+	/**
+	 * The number of deltas collected since the latest check
+	 */
+	uint16_t deltaCount = 0;
+
 	explicit PMONDeltaCheck(uint16_t monitoredParameterId, uint16_t repetitionNumber,
 	                        uint16_t numberOfConsecutiveDeltaChecks, double lowDeltaThreshold,
 	                        uint16_t belowLowThresholdEvent, double highDeltaThreshold,
 	                        uint16_t aboveHighThresholdEvent)
 	    : numberOfConsecutiveDeltaChecks(numberOfConsecutiveDeltaChecks), lowDeltaThreshold(lowDeltaThreshold),
 	      belowLowThresholdEvent(belowLowThresholdEvent), highDeltaThreshold(highDeltaThreshold),
-	      aboveHighThresholdEvent(aboveHighThresholdEvent), PMONBase(monitoredParameterId, repetitionNumber){};
+	      aboveHighThresholdEvent(aboveHighThresholdEvent), PMONBase(monitoredParameterId, repetitionNumber, DeltaCheck){};
+
+	/**
+	 * Adds a new sample of the monitored parameter. Once \ref numberOfConsecutiveDeltaChecks deltas between
+	 * consecutive samples have been collected, their average is returned so that it can be checked, and a new average
+	 * is started.
+	 *
+	 * @return The average delta, or nothing if more samples are needed
+	 */
+	std::optional<double> addSample(double value);
+
+	/**
+	 * Discards the collected deltas and the previous sample, so that the next sample starts a new average
+	 */
+	void resetDeltas() {
+		hasPreviousValue = false;
+		deltaSum = 0;
+		deltaCount = 0;
+	}
+
+	/**
+	 * Checks a batch of average deltas against their thresholds
+	 */
+	static void evaluate(const double* deltas, const double* lowThresholds, const double* highThresholds,
+	                     CheckingStatus* results, uint16_t count) {
+		for (uint16_t i = 0; i < count; i++) {
+			CheckingStatus aboveOrWithin = (deltas[i] > highThresholds[i]) ? AboveHighThreshold : WithinThreshold;
+			results[i] = (deltas[i] < lowThresholds[i]) ? BelowLowThreshold : aboveOrWithin;
+		}
+	}
+
+	/**
+	 * @return The event to raise when the checking status becomes \p status, if any
+	 */
+	std::optional<uint16_t> eventOf(CheckingStatus status) const {
+		if (status == BelowLowThreshold) {
+			return belowLowThresholdEvent;
+		}
+		if (status == AboveHighThreshold) {
+			return aboveHighThresholdEvent;
+		}
+		return {};
+	}
+
+	/**
+	 * @return The threshold crossed by a check transition, i.e. the low threshold if the delta went below or came
+	 * back from below it, and the high threshold otherwise
+	 */
+	double crossedLimitOf(CheckingStatus previousStatus, CheckingStatus currentStatus) const {
+		if (previousStatus == BelowLowThreshold or currentStatus == BelowLowThreshold) {
+			return lowDeltaThreshold;
+		}
+		return highDeltaThreshold;
+	}
 };
 #endif // ECSS_SERVICES_PMONBASE_HPP
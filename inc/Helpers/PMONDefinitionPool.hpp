@@ -0,0 +1,105 @@
+#ifndef ECSS_SERVICES_PMONDEFINITIONPOOL_HPP
+#define ECSS_SERVICES_PMONDEFINITIONPOOL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "etl/vector.h"
+
+/**
+ * Fixed-capacity storage for the ST[12] parameter monitoring definitions of a single check type.
+ *
+ * The definitions are owned by the pool and stored by value in a contiguous array, so that a monitoring cycle can
+ * check all definitions of a type with a linear scan. Their PMON IDs are kept in a separate, parallel array sorted in
+ * ascending order, so a definition is found with a binary search that only touches the IDs.
+ *
+ * Adding or removing a definition shifts the following entries, which is O(n), but this only happens on request from
+ * the ground. A pointer to a definition stays valid until a definition is added to or removed from the pool.
+ *
+ * @tparam Definition The check type, e.g. \ref PMONLimitCheck
+ * @tparam Capacity The max number of definitions of this type
+ */
+template <typename Definition, uint16_t Capacity>
+class PMONDefinitionPool {
+private:
+	etl::vector<uint16_t, Capacity> PMONIds;
+	etl::vector<Definition, Capacity> definitions;
+
+	/**
+	 * @return The index of the first definition whose PMON ID is not less than \p PMONId
+	 */
+	uint16_t lowerBound(uint16_t PMONId) const {
+		return std::lower_bound(PMONIds.begin(), PMONIds.end(), PMONId) - PMONIds.begin();
+	}
+
+public:
+	/**
+	 * @return The number of definitions
+	 */
+	uint16_t size() const {
+		return PMONIds.size();
+	}
+
+	bool empty() const {
+		return PMONIds.empty();
+	}
+
+	bool full() const {
+		return PMONIds.full();
+	}
+
+	/**
+	 * @return The definition with the given ID, or nullptr if it does not exist in this pool
+	 */
+	Definition* find(uint16_t PMONId) {
+		uint16_t index = lowerBound(PMONId);
+		if (index == size() or PMONIds[index] != PMONId) {
+			return nullptr;
+		}
+		return &definitions[index];
+	}
+
+	/**
+	 * Adds a copy of a definition, keeping the IDs sorted
+	 *
+	 * @return False if the ID already exists in this pool, or the pool is full
+	 */
+	bool insert(uint16_t PMONId, const Definition& definition) {
+		uint16_t index = lowerBound(PMONId);
+		if ((index < size() and PMONIds[index] == PMONId) or full()) {
+			return false;
+		}
+
+		PMONIds.insert(PMONIds.begin() + index, PMONId);
+		definitions.insert(definitions.begin() + index, definition);
+		return true;
+	}
+
+	/**
+	 * Removes the definition with the given ID, if it exists
+	 */
+	void erase(uint16_t PMONId) {
+		uint16_t index = lowerBound(PMONId);
+		if (index < size() and PMONIds[index] == PMONId) {
+			PMONIds.erase(PMONIds.begin() + index);
+			definitions.erase(definitions.begin() + index);
+		}
+	}
+
+	void clear() {
+		PMONIds.clear();
+		definitions.clear();
+	}
+
+	/**
+	 * @return The PMON ID of the definition stored at \p index
+	 */
+	uint16_t getPMONId(uint16_t index) const {
+		return PMONIds[index];
+	}
+
+	Definition& operator[](uint16_t index) {
+		return definitions[index];
+	}
+};
+
+#endif // ECSS_SERVICES_PMONDEFINITIONPOOL_HPP
@@ -1,9 +1,13 @@
 #ifndef ECSS_SERVICES_PARAMETER_HPP
 #define ECSS_SERVICES_PARAMETER_HPP
 
+#include <optional>
+#include <type_traits>
 #include "etl/String.hpp"
 #include "Message.hpp"
 #include "ECSS_Definitions.hpp"
+#include "Helpers/SeqLock.hpp"
+#include "etl/array.h"
 
 /**
  * Implementation of a Parameter field, as specified in ECSS-E-ST-70-41C.
@@ -29,12 +33,75 @@
  * would exclude from consideration constructs like etl::variant due to limitations on
  * the number of supported distinct types, a custom solution was needed.
  * Furthermore, the \ref ParameterService should provide ID-based access to parameters.
+ *
+ * @section Concurrency
+ * Parameters may be updated by producers running in other threads, while services such as ST[03] and ST[04] read
+ * them. Every parameter is protected by one of the \ref ECSSParameterLockShards sequence locks in \ref valueLocks, so
+ * that a reader can capture the values of several parameters as they were at a single instant, using
+ * \ref ParameterService::readConsistently(). An update only disturbs the readers of parameters in the same shard, and
+ * writers are never blocked by readers.
+ *
+ * Readers give up after a bounded number of attempts, so a steady producer cannot delay a report forever. See
+ * \ref SeqLock for why parameters that are read from interrupt handlers should not be written by preemptible code.
  */
 class ParameterBase {
 public:
+	/**
+	 * The sequence locks that protect the values of the parameters. Each parameter uses the lock of its
+	 * \ref lockShard.
+	 */
+	inline static etl::array<SeqLock, ECSSParameterLockShards> valueLocks;
+
+	/**
+	 * The value of \ref notificationIndex for parameters that are not tracked by the \ref ParameterService
+	 */
+	inline static constexpr uint16_t NoNotificationIndex = UINT16_MAX;
+
+	/**
+	 * The index of the parameter in the change notification tables of the \ref ParameterService. It is assigned by
+	 * the service when the parameter is registered.
+	 */
+	uint16_t notificationIndex = NoNotificationIndex;
+
+	/**
+	 * The index of the lock in \ref valueLocks that protects the value of this parameter. It is assigned by the
+	 * \ref ParameterService when the parameter is registered.
+	 */
+	uint8_t lockShard = 0;
+
+	/**
+	 * @return The lock that protects the value of this parameter
+	 */
+	SeqLock& valueLock() const {
+		return valueLocks[lockShard];
+	}
+
+	/**
+	 * @return The bit of \ref lockShard, to be combined into the shards passed to
+	 * \ref ParameterService::readConsistently()
+	 */
+	uint32_t lockShardMask() const {
+		return 1UL << lockShard;
+	}
+
 	virtual void appendValueToMessage(Message& message) = 0;
 	virtual void setValueFromMessage(Message& message) = 0;
 	virtual double getValueAsDouble() = 0;
+
+	/**
+	 * @return The value of an integer parameter converted to `uint64_t`, which keeps all of its bits so that it can be
+	 * masked, or nothing if the parameter is not of an integer type
+	 */
+	virtual std::optional<uint64_t> getValueAsUint64() {
+		return {};
+	}
+
+protected:
+	/**
+	 * Informs the \ref ParameterService that the value of this parameter has changed, so that consumers such as
+	 * ST[04] and ST[12] can process it.
+	 */
+	void notifyChange();
 };
 
 /**
@@ -48,25 +115,62 @@ private:
 	DataType currentValue;
 
 public:
-	explicit Parameter(DataType initialValue) : currentValue(initialValue) {}
+	/**
+	 * The constructor is `constexpr`, so that global parameters are constant-initialized before any dynamic
+	 * initialization runs. Otherwise, the \ref ParameterService of a global \ref ServicePool could register a
+	 * parameter, i.e. set its \ref notificationIndex and \ref lockShard, before the parameter is constructed, and
+	 * the constructor would then reset them.
+	 */
+	constexpr explicit Parameter(DataType initialValue) : currentValue(initialValue) {}
 
+	/**
+	 * Changes the value of the parameter, and notifies the \ref ParameterService if the value is different from the
+	 * previous one
+	 */
 	inline void setValue(DataType value) {
+		bool changed = not(currentValue == value);
+
+		SeqLock& lock = valueLock();
+		lock.beginWrite();
 		currentValue = value;
+		lock.endWrite();
+
+		if (changed and (notificationIndex != NoNotificationIndex)) {
+			notifyChange();
+		}
 	}
 
+	/**
+	 * Reads the value of the parameter. Values wider than a machine word could be torn by a concurrent write, so they
+	 * are read through the lock of the parameter.
+	 */
 	inline DataType getValue() {
-		return currentValue;
+		if constexpr (sizeof(DataType) > sizeof(uintptr_t)) {
+			DataType value;
+			valueLock().read([&]() { value = currentValue; });
+			return value;
+		} else {
+			return currentValue;
+		}
 	}
 
 	inline double getValueAsDouble() override {
-		return static_cast<double>(currentValue);
+		return static_cast<double>(getValue());
+	}
+
+	inline std::optional<uint64_t> getValueAsUint64() override {
+		if constexpr (std::is_integral_v<DataType> or std::is_enum_v<DataType>) {
+			return static_cast<uint64_t>(getValue());
+		} else {
+			return {};
+		}
 	}
 
 	/**
 	 * Given an ECSS message that contains this parameter as its first input, this loads the value from that paremeter
 	 */
 	inline void setValueFromMessage(Message& message) override {
-		currentValue = message.read<DataType>();
+		setValue(message.read<DataType>());
 	};
 
 	/**
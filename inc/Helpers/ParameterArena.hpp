@@ -0,0 +1,554 @@
+#ifndef ECSS_SERVICES_PARAMETERARENA_HPP
+#define ECSS_SERVICES_PARAMETERARENA_HPP
+
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include "ECSS_Definitions.hpp"
+#include "ErrorHandler.hpp"
+#include "Message.hpp"
+#include "Helpers/Parameter.hpp"
+#include "Helpers/SeqLock.hpp"
+#include "etl/array.h"
+
+/**
+ * The PUS type of a value stored in a \ref ParameterArena slot. This is stored in the type-tag table of the arena,
+ * and replaces the per-parameter virtual functions of \ref ParameterBase.
+ */
+enum class ParameterType : uint8_t {
+	Boolean = 0,
+	Uint8 = 1,
+	Uint16 = 2,
+	Uint32 = 3,
+	Uint64 = 4,
+	Sint8 = 5,
+	Sint16 = 6,
+	Sint32 = 7,
+	Sint64 = 8,
+	Float = 9,
+	Double = 10,
+};
+
+/**
+ * Compile-time conversion of a C++ type to the \ref ParameterType tag that describes it
+ */
+template <typename DataType>
+inline constexpr ParameterType parameterTypeOf() {
+	if constexpr (std::is_same_v<DataType, bool>) {
+		return ParameterType::Boolean;
+	} else if constexpr (std::is_same_v<DataType, uint8_t>) {
+		return ParameterType::Uint8;
+	} else if constexpr (std::is_same_v<DataType, uint16_t>) {
+		return ParameterType::Uint16;
+	} else if constexpr (std::is_same_v<DataType, uint32_t>) {
+		return ParameterType::Uint32;
+	} else if constexpr (std::is_same_v<DataType, uint64_t>) {
+		return ParameterType::Uint64;
+	} else if constexpr (std::is_same_v<DataType, int8_t>) {
+		return ParameterType::Sint8;
+	} else if constexpr (std::is_same_v<DataType, int16_t>) {
+		return ParameterType::Sint16;
+	} else if constexpr (std::is_same_v<DataType, int32_t>) {
+		return ParameterType::Sint32;
+	} else if constexpr (std::is_same_v<DataType, int64_t>) {
+		return ParameterType::Sint64;
+	} else if constexpr (std::is_same_v<DataType, float>) {
+		return ParameterType::Float;
+	} else {
+		static_assert(std::is_same_v<DataType, double>, "Unsupported parameter type");
+		return ParameterType::Double;
+	}
+}
+
+/**
+ * A non-virtual, type-erased storage for parameters, as an alternative to separate \ref Parameter objects.
+ *
+ * @section Layout
+ * Every parameter occupies one 8-byte slot of a single contiguous, cache-line-aligned value array. The type of each
+ * slot is kept in a separate type-tag table, and the PUS ID of each slot in an ID table. Accessing a parameter
+ * dispatches on its tag with a `switch`, instead of a virtual call through a pointer to an object that may live
+ * anywhere in memory.
+ *
+ * Since all values are stored next to each other, the whole set can be copied with a single `memcpy` using
+ * \ref snapshot(), or converted to doubles in one tight loop using \ref snapshotAsDouble(). This is intended for
+ * consumers that need every value at once. Each slot can also be wrapped in an \ref ArenaParameter, so that it is
+ * registered in the \ref ParameterService and read by the statistics and housekeeping services like any parameter.
+ * Updates are protected by a \ref SeqLock, so a snapshot never mixes values from before and after a concurrent update,
+ * and never contains torn 64-bit values.
+ *
+ * A parameter is found by its ID through an open-addressing hash table with linear probing, in O(1) expected time,
+ * so adding all parameters takes linear time overall.
+ *
+ * @note Slots are allocated in the order that parameters are added, and they are never freed. The index returned by
+ * \ref add() can be stored by the caller to skip the ID lookup in hot paths.
+ *
+ * @tparam Capacity The maximum number of parameters that can be stored
+ */
+template <uint16_t Capacity>
+class ParameterArena {
+public:
+	/**
+	 * The raw representation of a single slot
+	 */
+	typedef uint64_t Slot;
+
+	/**
+	 * The alignment of the value array, equal to a common cache line size
+	 */
+	inline static constexpr size_t Alignment = 64;
+
+private:
+	static constexpr uint16_t NoSlot = UINT16_MAX;
+
+	/**
+	 * The number of entries of the ID table, a power of two that keeps the table at most half full
+	 */
+	static constexpr uint32_t TableSize = [] {
+		uint32_t size = 1;
+		while (size < 2U * Capacity) {
+			size *= 2;
+		}
+		return size;
+	}();
+
+	/**
+	 * The values of all parameters. Each value is stored in the first `sizeof(DataType)` bytes of its slot.
+	 */
+	alignas(Alignment) etl::array<Slot, Capacity> values = {};
+
+	/**
+	 * The type of the value stored in each slot
+	 */
+	etl::array<ParameterType, Capacity> types = {};
+
+	/**
+	 * The PUS ID of the parameter stored in each slot
+	 */
+	etl::array<uint16_t, Capacity> ids = {};
+
+	/**
+	 * The slots in use, stored at the position given by the hash of their parameter ID, or at the next free position
+	 */
+	etl::array<uint16_t, TableSize> table;
+
+	/**
+	 * The number of slots that are in use
+	 */
+	uint16_t count = 0;
+
+	/**
+	 * Protects the values from concurrent updates while a snapshot is taken
+	 */
+	SeqLock valuesLock;
+
+	static uint32_t homePosition(uint16_t parameterId) {
+		// Mix the bits, so that consecutive IDs do not fill consecutive positions
+		uint32_t value = parameterId * 0x45d9f3bU;
+		value ^= value >> 16U;
+		return value & (TableSize - 1);
+	}
+
+	/**
+	 * @return The position of \p parameterId in \ref table, or the free position where it would be added
+	 */
+	uint32_t tablePosition(uint16_t parameterId) const {
+		uint32_t position = homePosition(parameterId);
+		while (table[position] != NoSlot and ids[table[position]] != parameterId) {
+			position = (position + 1) & (TableSize - 1);
+		}
+		return position;
+	}
+
+	/**
+	 * Reads a single slot, without tearing if it is updated concurrently
+	 */
+	inline Slot loadSlot(uint16_t index) const {
+		Slot slot;
+		if (not valuesLock.read([&]() { slot = values[index]; })) {
+			ErrorHandler::reportInternalError(ErrorHandler::InconsistentParameterRead);
+		}
+		return slot;
+	}
+
+	static double decodeAsDouble(ParameterType type, const Slot& slot) {
+		switch (type) {
+			case ParameterType::Boolean:
+				return static_cast<double>(decode<bool>(slot));
+			case ParameterType::Uint8:
+				return static_cast<double>(decode<uint8_t>(slot));
+			case ParameterType::Uint16:
+				return static_cast<double>(decode<uint16_t>(slot));
+			case ParameterType::Uint32:
+				return static_cast<double>(decode<uint32_t>(slot));
+			case ParameterType::Uint64:
+				return static_cast<double>(decode<uint64_t>(slot));
+			case ParameterType::Sint8:
+				return static_cast<double>(decode<int8_t>(slot));
+			case ParameterType::Sint16:
+				return static_cast<double>(decode<int16_t>(slot));
+			case ParameterType::Sint32:
+				return static_cast<double>(decode<int32_t>(slot));
+			case ParameterType::Sint64:
+				return static_cast<double>(decode<int64_t>(slot));
+			case ParameterType::Float:
+				return static_cast<double>(decode<float>(slot));
+			case ParameterType::Double:
+				return decode<double>(slot);
+		}
+
+		return 0;
+	}
+
+	static std::optional<uint64_t> decodeAsUint64(ParameterType type, const Slot& slot) {
+		switch (type) {
+			case ParameterType::Boolean:
+				return static_cast<uint64_t>(decode<bool>(slot));
+			case ParameterType::Uint8:
+				return decode<uint8_t>(slot);
+			case ParameterType::Uint16:
+				return decode<uint16_t>(slot);
+			case ParameterType::Uint32:
+				return decode<uint32_t>(slot);
+			case ParameterType::Uint64:
+				return decode<uint64_t>(slot);
+			case ParameterType::Sint8:
+				return static_cast<uint64_t>(decode<int8_t>(slot));
+			case ParameterType::Sint16:
+				return static_cast<uint64_t>(decode<int16_t>(slot));
+			case ParameterType::Sint32:
+				return static_cast<uint64_t>(decode<int32_t>(slot));
+			case ParameterType::Sint64:
+				return static_cast<uint64_t>(decode<int64_t>(slot));
+			case ParameterType::Float:
+			case ParameterType::Double:
+				return {};
+		}
+
+		return {};
+	}
+
+	template <typename DataType>
+	inline static Slot encode(DataType value) {
+		Slot slot = 0;
+		std::memcpy(&slot, &value, sizeof(DataType));
+		return slot;
+	}
+
+	/**
+	 * Reads a value of type \p type from a message, before it is stored in a slot
+	 */
+	static Slot readSlot(ParameterType type, Message& message) {
+		switch (type) {
+			case ParameterType::Boolean:
+				return encode<bool>(message.read<bool>());
+			case ParameterType::Uint8:
+				return encode<uint8_t>(message.read<uint8_t>());
+			case ParameterType::Uint16:
+				return encode<uint16_t>(message.read<uint16_t>());
+			case ParameterType::Uint32:
+				return encode<uint32_t>(message.read<uint32_t>());
+			case ParameterType::Uint64:
+				return encode<uint64_t>(message.read<uint64_t>());
+			case ParameterType::Sint8:
+				return encode<int8_t>(message.read<int8_t>());
+			case ParameterType::Sint16:
+				return encode<int16_t>(message.read<int16_t>());
+			case ParameterType::Sint32:
+				return encode<int32_t>(message.read<int32_t>());
+			case ParameterType::Sint64:
+				return encode<int64_t>(message.read<int64_t>());
+			case ParameterType::Float:
+				return encode<float>(message.read<float>());
+			case ParameterType::Double:
+				return encode<double>(message.read<double>());
+		}
+
+		return 0;
+	}
+
+	/**
+	 * Replaces the value of a slot. The message or value is decoded before this is called, so that the write section
+	 * of the lock is as short as possible.
+	 */
+	inline void store(uint16_t index, Slot slot) {
+		valuesLock.beginWrite();
+		values[index] = slot;
+		valuesLock.endWrite();
+	}
+
+public:
+	/**
+	 * Extracts a value of type \p DataType from a slot, e.g. one copied by \ref snapshot()
+	 */
+	template <typename DataType>
+	inline static DataType decode(const Slot& slot) {
+		DataType value;
+		std::memcpy(&value, &slot, sizeof(DataType));
+		return value;
+	}
+
+	ParameterArena() {
+		table.fill(NoSlot);
+	}
+
+	/**
+	 * Adds a new parameter to the arena
+	 *
+	 * @param parameterId The PUS ID of the parameter. It must not already exist in the arena.
+	 * @param initialValue The initial value of the parameter, whose type determines the type of the slot
+	 * @return The index of the slot of the new parameter, or nothing if the arena is full or the ID already exists
+	 */
+	template <typename DataType>
+	std::optional<uint16_t> add(uint16_t parameterId, DataType initialValue) {
+		static_assert(sizeof(DataType) <= sizeof(Slot), "Parameter does not fit in an arena slot");
+
+		if (count >= Capacity) {
+			ErrorHandler::reportInternalError(ErrorHandler::MapFull);
+			return {};
+		}
+		uint32_t position = tablePosition(parameterId);
+		if (table[position] != NoSlot) {
+			return {};
+		}
+
+		table[position] = count;
+		ids[count] = parameterId;
+		types[count] = parameterTypeOf<DataType>();
+		values[count] = encode<DataType>(initialValue);
+
+		return count++;
+	}
+
+	/**
+	 * @return The number of parameters stored in the arena
+	 */
+	uint16_t size() const {
+		return count;
+	}
+
+	/**
+	 * Finds the slot of a parameter
+	 *
+	 * @param parameterId The PUS ID of the parameter
+	 * @return The index of the slot, or nothing if the parameter does not exist
+	 */
+	std::optional<uint16_t> findIndex(uint16_t parameterId) const {
+		uint16_t slot = table[tablePosition(parameterId)];
+		if (slot == NoSlot) {
+			return {};
+		}
+
+		return slot;
+	}
+
+	/**
+	 * @return The PUS ID of the parameter stored at \p index
+	 */
+	uint16_t getId(uint16_t index) const {
+		return ids[index];
+	}
+
+	/**
+	 * @return The type of the parameter stored at \p index
+	 */
+	ParameterType getType(uint16_t index) const {
+		return types[index];
+	}
+
+	/**
+	 * Reads the value of a parameter. \p DataType must be the same type that the parameter was added with.
+	 */
+	template <typename DataType>
+	DataType getValue(uint16_t index) const {
+		ASSERT_INTERNAL(types[index] == parameterTypeOf<DataType>(), ErrorHandler::ParameterTypeMismatch);
+		return decode<DataType>(loadSlot(index));
+	}
+
+	/**
+	 * Changes the value of a parameter. \p DataType must be the same type that the parameter was added with.
+	 */
+	template <typename DataType>
+	void setValue(uint16_t index, DataType value) {
+		ASSERT_INTERNAL(types[index] == parameterTypeOf<DataType>(), ErrorHandler::ParameterTypeMismatch);
+		store(index, encode<DataType>(value));
+	}
+
+	/**
+	 * The equivalent of \ref ParameterBase::getValueAsDouble() for the parameter stored at \p index
+	 */
+	double getValueAsDouble(uint16_t index) const {
+		return decodeAsDouble(types[index], loadSlot(index));
+	}
+
+	/**
+	 * The equivalent of \ref ParameterBase::getValueAsUint64() for the parameter stored at \p index
+	 */
+	std::optional<uint64_t> getValueAsUint64(uint16_t index) const {
+		return decodeAsUint64(types[index], loadSlot(index));
+	}
+
+	/**
+	 * The equivalent of \ref ParameterBase::appendValueToMessage() for the parameter stored at \p index
+	 */
+	void appendValueToMessage(uint16_t index, Message& message) const {
+		Slot slot = loadSlot(index);
+
+		switch (types[index]) {
+			case ParameterType::Boolean:
+				message.append<bool>(decode<bool>(slot));
+				break;
+			case ParameterType::Uint8:
+				message.append<uint8_t>(decode<uint8_t>(slot));
+				break;
+			case ParameterType::Uint16:
+				message.append<uint16_t>(decode<uint16_t>(slot));
+				break;
+			case ParameterType::Uint32:
+				message.append<uint32_t>(decode<uint32_t>(slot));
+				break;
+			case ParameterType::Uint64:
+				message.append<uint64_t>(decode<uint64_t>(slot));
+				break;
+			case ParameterType::Sint8:
+				message.append<int8_t>(decode<int8_t>(slot));
+				break;
+			case ParameterType::Sint16:
+				message.append<int16_t>(decode<int16_t>(slot));
+				break;
+			case ParameterType::Sint32:
+				message.append<int32_t>(decode<int32_t>(slot));
+				break;
+			case ParameterType::Sint64:
+				message.append<int64_t>(decode<int64_t>(slot));
+				break;
+			case ParameterType::Float:
+				message.append<float>(decode<float>(slot));
+				break;
+			case ParameterType::Double:
+				message.append<double>(decode<double>(slot));
+				break;
+		}
+	}
+
+	/**
+	 * The equivalent of \ref ParameterBase::setValueFromMessage() for the parameter stored at \p index
+	 */
+	void setValueFromMessage(uint16_t index, Message& message) {
+		store(index, readSlot(types[index], message));
+	}
+
+	/**
+	 * @return The raw slot of the parameter stored at \p index, e.g. to check whether its value has changed
+	 */
+	Slot getSlot(uint16_t index) const {
+		return loadSlot(index);
+	}
+
+	/**
+	 * Copies the raw slots of all parameters to \p destination with a single `memcpy`. The slots can be decoded later
+	 * using the type-tag table of this arena.
+	 *
+	 * @param destination An array that can hold at least \ref size() slots
+	 * @return The number of slots copied
+	 */
+	uint16_t snapshot(Slot* destination) const {
+		if (not valuesLock.read([&]() { std::memcpy(destination, values.data(), count * sizeof(Slot)); })) {
+			ErrorHandler::reportInternalError(ErrorHandler::InconsistentParameterRead);
+		}
+		return count;
+	}
+
+	/**
+	 * Converts the values of all parameters to doubles, in slot order
+	 *
+	 * @param destination An array that can hold at least \ref size() doubles
+	 * @return The number of values written
+	 */
+	uint16_t snapshotAsDouble(double* destination) const {
+		bool isConsistent = valuesLock.read([&]() {
+			for (uint16_t index = 0; index < count; index++) {
+				destination[index] = decodeAsDouble(types[index], values[index]);
+			}
+		});
+		if (not isConsistent) {
+			ErrorHandler::reportInternalError(ErrorHandler::InconsistentParameterRead);
+		}
+		return count;
+	}
+};
+
+/**
+ * A \ref ParameterBase that is backed by a slot of a \ref ParameterArena, so that the parameters of an arena can be
+ * registered in the \ref ParameterService and used by every service that reads parameters through it, such as ST[03]
+ * housekeeping and ST[04] statistics. The arena can still take bulk snapshots of the same values.
+ *
+ * Values should be changed through this class, instead of directly through the arena, so that the lock shard of the
+ * parameter is taken and the \ref ParameterService is notified of the change.
+ *
+ * @tparam Capacity The capacity of the arena
+ */
+template <uint16_t Capacity>
+class ArenaParameter : public ParameterBase {
+private:
+	ParameterArena<Capacity>& arena;
+	uint16_t index;
+
+	/**
+	 * Notifies the \ref ParameterService if the slot differs from \p previousSlot
+	 */
+	void notifyIfChanged(typename ParameterArena<Capacity>::Slot previousSlot) {
+		if (arena.getSlot(index) != previousSlot and (notificationIndex != NoNotificationIndex)) {
+			notifyChange();
+		}
+	}
+
+public:
+	/**
+	 * The constructor is `constexpr` for the same reason as the one of \ref Parameter
+	 *
+	 * @param index The slot of the parameter, as returned by \ref ParameterArena::add()
+	 */
+	constexpr ArenaParameter(ParameterArena<Capacity>& arena, uint16_t index) : arena(arena), index(index) {}
+
+	template <typename DataType>
+	DataType getValue() const {
+		return arena.template getValue<DataType>(index);
+	}
+
+	template <typename DataType>
+	void setValue(DataType value) {
+		auto previousSlot = arena.getSlot(index);
+
+		SeqLock& lock = valueLock();
+		lock.beginWrite();
+		arena.template setValue<DataType>(index, value);
+		lock.endWrite();
+
+		notifyIfChanged(previousSlot);
+	}
+
+	double getValueAsDouble() override {
+		return arena.getValueAsDouble(index);
+	}
+
+	std::optional<uint64_t> getValueAsUint64() override {
+		return arena.getValueAsUint64(index);
+	}
+
+	void appendValueToMessage(Message& message) override {
+		arena.appendValueToMessage(index, message);
+	}
+
+	void setValueFromMessage(Message& message) override {
+		auto previousSlot = arena.getSlot(index);
+
+		SeqLock& lock = valueLock();
+		lock.beginWrite();
+		arena.setValueFromMessage(index, message);
+		lock.endWrite();
+
+		notifyIfChanged(previousSlot);
+	}
+};
+
+#endif // ECSS_SERVICES_PARAMETERARENA_HPP
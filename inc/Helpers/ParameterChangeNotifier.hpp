@@ -0,0 +1,151 @@
+#ifndef ECSS_SERVICES_PARAMETERCHANGENOTIFIER_HPP
+#define ECSS_SERVICES_PARAMETERCHANGENOTIFIER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include "ECSS_Definitions.hpp"
+#include "etl/array.h"
+#include "etl/binary.h"
+#include "etl/vector.h"
+
+/**
+ * Keeps track of the parameters whose value has changed, so that services that process parameter values (such as
+ * ST[04] and ST[12]) only need to visit the parameters that actually changed, instead of polling all of them.
+ *
+ * Every parameter known to \ref ParameterService gets a dense index, and every consumer gets its own dirty bitmap,
+ * in which each changed parameter sets its bit. A consumer drains its bitmap whenever it runs, which visits the
+ * changed parameters and clears their bits. In addition, callbacks can be subscribed to individual parameters, and
+ * are called right after each change.
+ *
+ * The bitmaps are updated with atomic operations, so parameters may change from other threads while a consumer
+ * drains them. A change that happens during a drain is either visited by it, or remains marked for the next one.
+ */
+class ParameterChangeNotifier {
+public:
+	/**
+	 * The services that keep a dirty bitmap of changed parameters
+	 */
+	enum Consumer : uint8_t {
+		Statistics = 0,
+		Monitoring = 1,
+		NumberOfConsumers = 2,
+	};
+
+	/**
+	 * A function to be called when a parameter changes. It is called from the context that changed the parameter.
+	 */
+	typedef void (*Callback)(uint16_t parameterId);
+
+private:
+	inline static constexpr uint8_t BitsPerWord = 32;
+	inline static constexpr uint16_t NumberOfWords = (ECSSParameterCount + BitsPerWord - 1) / BitsPerWord;
+
+	/**
+	 * One dirty bitmap per consumer. Bit `i` corresponds to the parameter with index `i`.
+	 */
+	etl::array<etl::array<std::atomic<uint32_t>, NumberOfWords>, NumberOfConsumers> dirtyParameters{};
+
+	/**
+	 * The PUS ID of the parameter with each index
+	 */
+	etl::array<uint16_t, ECSSParameterCount> parameterIds = {};
+
+	/**
+	 * The callbacks subscribed to each parameter
+	 */
+	etl::array<etl::vector<Callback, ECSSMaxParameterSubscribers>, ECSSParameterCount> subscribers;
+
+public:
+	/**
+	 * The indices of the parameters that changed during a period, taken from the bitmap of a consumer with
+	 * \ref takeChanges()
+	 */
+	class ChangeSet {
+		friend class ParameterChangeNotifier;
+
+		etl::array<uint32_t, NumberOfWords> words = {};
+
+	public:
+		/**
+		 * @return True if the parameter with the given index is in the set
+		 */
+		bool contains(uint16_t index) const {
+			return (index < ECSSParameterCount) and ((words[index / BitsPerWord] >> (index % BitsPerWord)) & 1U) != 0U;
+		}
+	};
+
+	/**
+	 * Associates the index of a parameter with its PUS ID
+	 */
+	void registerParameter(uint16_t index, uint16_t parameterId) {
+		parameterIds[index] = parameterId;
+	}
+
+	/**
+	 * Adds a callback to be called whenever the parameter with the given index changes
+	 *
+	 * @return False if the parameter already has the maximum number of subscribers
+	 */
+	bool subscribe(uint16_t index, Callback callback) {
+		if (subscribers[index].full()) {
+			return false;
+		}
+		subscribers[index].push_back(callback);
+		return true;
+	}
+
+	/**
+	 * Marks the parameter with the given index as changed for all consumers, and calls its subscribers
+	 */
+	void notify(uint16_t index) {
+		uint32_t bit = 1U << (index % BitsPerWord);
+		for (auto& bitmap : dirtyParameters) {
+			bitmap[index / BitsPerWord].fetch_or(bit, std::memory_order_release);
+		}
+		for (auto callback : subscribers[index]) {
+			callback(parameterIds[index]);
+		}
+	}
+
+	/**
+	 * @return True if the parameter with the given index has changed since the last drain of \p consumer
+	 */
+	bool isChanged(Consumer consumer, uint16_t index) const {
+		uint32_t bit = 1U << (index % BitsPerWord);
+		return (dirtyParameters[consumer][index / BitsPerWord].load(std::memory_order_acquire) & bit) != 0U;
+	}
+
+	/**
+	 * Takes all parameters that changed since the previous drain of \p consumer, and clears their marks. A change that
+	 * happens while the set is taken is either in the set, or remains marked for the next drain.
+	 */
+	ChangeSet takeChanges(Consumer consumer) {
+		ChangeSet changes;
+		for (uint16_t word = 0; word < NumberOfWords; word++) {
+			changes.words[word] = dirtyParameters[consumer][word].exchange(0, std::memory_order_acq_rel);
+		}
+		return changes;
+	}
+
+	/**
+	 * Visits every parameter that changed since the previous drain of \p consumer, and clears its mark.
+	 *
+	 * Each word of the bitmap is claimed with a single atomic exchange, and only its set bits are visited, so the
+	 * cost is proportional to the number of changed parameters rather than the total number of parameters.
+	 *
+	 * @param visitor A function that receives the PUS ID of each changed parameter
+	 */
+	template <typename Visitor>
+	void drain(Consumer consumer, Visitor&& visitor) {
+		for (uint16_t word = 0; word < NumberOfWords; word++) {
+			uint32_t changed = dirtyParameters[consumer][word].exchange(0, std::memory_order_acq_rel);
+			while (changed != 0U) {
+				auto bit = static_cast<uint16_t>(etl::count_trailing_zeros(changed));
+				changed &= changed - 1U;
+				visitor(parameterIds[word * BitsPerWord + bit]);
+			}
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_PARAMETERCHANGENOTIFIER_HPP
@@ -0,0 +1,134 @@
+#ifndef ECSS_SERVICES_QUANTILESKETCH_HPP
+#define ECSS_SERVICES_QUANTILESKETCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "ECSS_Definitions.hpp"
+#include "etl/array.h"
+
+/**
+ * An approximate histogram of a set of values, used to estimate percentiles in a fixed amount of memory.
+ *
+ * The sketch divides the magnitudes of the values into logarithmically-sized buckets, so that every value in a bucket
+ * is within a fixed relative error of the bucket's representative value (the DDSketch mapping). Adding or removing a
+ * value only changes the counter of its bucket, so values can be removed again when they leave a sliding window.
+ *
+ * Buckets for negative values, zero and positive values are stored in a single array in ascending order of value, so a
+ * percentile is found with a single cumulative scan. Magnitudes outside the range covered by the buckets are clamped to
+ * the smallest or largest bucket.
+ *
+ * @tparam Buckets The number of buckets for each sign. With a relative accuracy `a`, the buckets cover magnitudes
+ * of `gamma^(-Buckets/2)` to `gamma^(Buckets/2)`, where `gamma = (1 + a) / (1 - a)`.
+ */
+template <uint16_t Buckets = ECSSQuantileSketchBuckets>
+class QuantileSketch {
+private:
+	/**
+	 * The index of the bucket that holds zero. Negative values are stored before it, and positive ones after it.
+	 */
+	inline static constexpr uint16_t ZeroBucket = Buckets;
+
+	etl::array<uint16_t, 2 * Buckets + 1> counts = {};
+
+	uint32_t totalCount = 0;
+
+	/**
+	 * The natural logarithm of the ratio between the bounds of each bucket
+	 */
+	double logGamma;
+
+	/**
+	 * @return The position of the bucket of magnitude \p magnitude, between 0 and `Buckets - 1`
+	 */
+	uint16_t magnitudeBucket(double magnitude) const {
+		double bucket = std::ceil(std::log(magnitude) / logGamma) + Buckets / 2;
+		return static_cast<uint16_t>(std::clamp(bucket, 0.0, static_cast<double>(Buckets - 1)));
+	}
+
+	uint16_t bucketOf(double value) const {
+		if (value > 0) {
+			return ZeroBucket + 1 + magnitudeBucket(value);
+		}
+		if (value < 0) {
+			return ZeroBucket - 1 - magnitudeBucket(-value);
+		}
+		return ZeroBucket;
+	}
+
+	/**
+	 * @return The value that represents all values in \p bucket, with the lowest maximum relative error
+	 */
+	double representativeValue(uint16_t bucket) const {
+		if (bucket == ZeroBucket) {
+			return 0;
+		}
+
+		bool isPositive = bucket > ZeroBucket;
+		int32_t magnitudeIndex = (isPositive ? (bucket - ZeroBucket - 1) : (ZeroBucket - 1 - bucket)) - Buckets / 2;
+		double gamma = std::exp(logGamma);
+		double magnitude = 2 * std::exp(magnitudeIndex * logGamma) / (gamma + 1);
+
+		return isPositive ? magnitude : -magnitude;
+	}
+
+public:
+	/**
+	 * @param relativeAccuracy The max relative error of the estimated percentiles, between 0 and 1
+	 */
+	explicit QuantileSketch(double relativeAccuracy = 0.05)
+	    : logGamma(std::log((1 + relativeAccuracy) / (1 - relativeAccuracy))) {}
+
+	void add(double value) {
+		counts[bucketOf(value)]++;
+		totalCount++;
+	}
+
+	/**
+	 * Removes a value that was previously added
+	 */
+	void remove(double value) {
+		uint16_t bucket = bucketOf(value);
+		if (counts[bucket] > 0) {
+			counts[bucket]--;
+			totalCount--;
+		}
+	}
+
+	void clear() {
+		counts.fill(0);
+		totalCount = 0;
+	}
+
+	/**
+	 * @return The number of values in the sketch
+	 */
+	uint32_t size() const {
+		return totalCount;
+	}
+
+	/**
+	 * Estimates the value below which a fraction \p quantile of the values lies
+	 *
+	 * @param quantile The fraction, between 0 and 1 (e.g. 0.95 for the 95th percentile)
+	 * @return The estimated value, or 0 if the sketch is empty
+	 */
+	double getQuantile(double quantile) const {
+		if (totalCount == 0) {
+			return 0;
+		}
+
+		auto rank = static_cast<uint32_t>(std::clamp(quantile, 0.0, 1.0) * (totalCount - 1));
+		uint32_t cumulativeCount = 0;
+		for (uint16_t bucket = 0; bucket < counts.size(); bucket++) {
+			cumulativeCount += counts[bucket];
+			if (cumulativeCount > rank) {
+				return representativeValue(bucket);
+			}
+		}
+
+		return representativeValue(counts.size() - 1);
+	}
+};
+
+#endif // ECSS_SERVICES_QUANTILESKETCH_HPP
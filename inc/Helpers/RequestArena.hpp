@@ -0,0 +1,154 @@
+#ifndef ECSS_SERVICES_REQUESTARENA_HPP
+#define ECSS_SERVICES_REQUESTARENA_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "etl/array.h"
+#include "etl/vector.h"
+
+/**
+ * Fixed-size storage for variable-length byte strings, such as the TC packets of a time-based schedule.
+ *
+ * All entries share a single byte array, instead of each one reserving space for the largest possible entry. The
+ * entries are packed one after the other, and each one starts with a header that contains its length and its handle:
+ *
+ * | length (2 bytes) | handle (2 bytes) | length bytes of data |
+ *
+ * An entry is referred to by its handle, which stays valid until the entry is erased. Erasing an entry moves all the
+ * following entries back, so that the free space is always at the end of the array and there is no fragmentation.
+ * The length of each entry is used to walk the following entries, and their handle to update their positions.
+ * Erasing is therefore O(n) in the number of bytes after the erased entry, while storing and accessing an entry is
+ * O(1).
+ *
+ * @tparam Size The size of the byte array, including the headers of the entries
+ * @tparam Capacity The max number of entries
+ */
+template <uint16_t Size, uint16_t Capacity>
+class RequestArena {
+public:
+	using Handle = uint16_t;
+
+	static constexpr Handle NoHandle = UINT16_MAX;
+
+	/**
+	 * The number of bytes of the header of each entry
+	 */
+	static constexpr uint16_t HeaderSize = 4;
+
+private:
+	etl::array<uint8_t, Size> bytes;
+
+	/**
+	 * The number of bytes used by the entries, which are stored in the first bytes of \ref bytes
+	 */
+	uint16_t usedBytes = 0;
+
+	/**
+	 * The position in \ref bytes of the header of the entry of each handle
+	 */
+	etl::array<uint16_t, Capacity> positions;
+
+	etl::vector<Handle, Capacity> freeHandles;
+
+	uint16_t readHeaderField(uint16_t position) const {
+		return (static_cast<uint16_t>(bytes[position]) << 8U) | bytes[position + 1];
+	}
+
+	void writeHeaderField(uint16_t position, uint16_t value) {
+		bytes[position] = value >> 8U;
+		bytes[position + 1] = value & 0xFFU;
+	}
+
+public:
+	RequestArena() {
+		clear();
+	}
+
+	void clear() {
+		usedBytes = 0;
+		freeHandles.clear();
+		for (Handle handle = Capacity; handle > 0; handle--) {
+			freeHandles.push_back(handle - 1);
+		}
+	}
+
+	/**
+	 * @return The number of stored entries
+	 */
+	uint16_t size() const {
+		return Capacity - freeHandles.size();
+	}
+
+	bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	 * @return The number of bytes used by the entries, including their headers
+	 */
+	uint16_t bytesUsed() const {
+		return usedBytes;
+	}
+
+	/**
+	 * @return True if an entry of \p length bytes can be stored
+	 */
+	bool canStore(uint16_t length) const {
+		return not freeHandles.empty() and static_cast<uint32_t>(usedBytes) + HeaderSize + length <= Size;
+	}
+
+	/**
+	 * Adds a copy of \p length bytes from \p data
+	 *
+	 * @return The handle of the new entry, or \ref NoHandle if there is not enough space
+	 */
+	Handle store(const uint8_t* data, uint16_t length) {
+		if (not canStore(length)) {
+			return NoHandle;
+		}
+
+		Handle handle = freeHandles.back();
+		freeHandles.pop_back();
+
+		positions[handle] = usedBytes;
+		writeHeaderField(usedBytes, length);
+		writeHeaderField(usedBytes + 2, handle);
+		std::copy(data, data + length, bytes.begin() + usedBytes + HeaderSize);
+		usedBytes += HeaderSize + length;
+
+		return handle;
+	}
+
+	/**
+	 * Removes an entry, and moves back the entries after it
+	 */
+	void erase(Handle handle) {
+		uint16_t position = positions[handle];
+		uint16_t entrySize = HeaderSize + length(handle);
+
+		std::copy(bytes.begin() + position + entrySize, bytes.begin() + usedBytes, bytes.begin() + position);
+		usedBytes -= entrySize;
+
+		for (uint16_t next = position; next < usedBytes; next += HeaderSize + readHeaderField(next)) {
+			positions[readHeaderField(next + 2)] = next;
+		}
+
+		freeHandles.push_back(handle);
+	}
+
+	/**
+	 * @return The number of data bytes of an entry
+	 */
+	uint16_t length(Handle handle) const {
+		return readHeaderField(positions[handle]);
+	}
+
+	/**
+	 * @return The data of an entry. The pointer is invalidated when any entry is erased.
+	 */
+	const uint8_t* data(Handle handle) const {
+		return bytes.data() + positions[handle] + HeaderSize;
+	}
+};
+
+#endif // ECSS_SERVICES_REQUESTARENA_HPP
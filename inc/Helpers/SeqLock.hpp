@@ -0,0 +1,102 @@
+#ifndef ECSS_SERVICES_SEQLOCK_HPP
+#define ECSS_SERVICES_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * A sequence lock, used to give readers a consistent view of data that is updated by one or more writers, without
+ * ever blocking the writers.
+ *
+ * Writers surround their updates with \ref beginWrite() and \ref endWrite(). Readers copy the data they need inside
+ * \ref read(), which retries the copy until no write has started or finished in the meantime, up to a bounded number
+ * of attempts. Writers only perform two atomic increments, so they are never delayed by readers, and they do not need
+ * to be serialised with each other.
+ *
+ * The state is a single 32-bit word, so that it is lock-free on 32-bit microcontrollers:
+ * - the lowest \ref WriterBits bits count the writers that are currently updating the data
+ * - the remaining bits are a generation counter, incremented every time a write finishes
+ *
+ * @note Two writers updating the *same* value at the same time still race with each other. The lock only guarantees
+ * that readers never observe a half-finished set of updates.
+ *
+ * @warning Readers never wait for a writer to finish, since a reader running in an interrupt handler that preempted a
+ * writer would wait forever. Such a reader, or one that keeps being overtaken by writers, gives up after the max
+ * number of attempts and keeps a copy that may be inconsistent. Data that is read from interrupt handlers should
+ * therefore not be written by code that the handler can preempt.
+ */
+class SeqLock {
+public:
+	/**
+	 * The number of bits of the state that count the active writers
+	 */
+	inline static constexpr uint8_t WriterBits = 8;
+
+	/**
+	 * The default max number of times that \ref read() runs its reader
+	 */
+	inline static constexpr uint8_t DefaultReadAttempts = 8;
+
+private:
+	inline static constexpr uint32_t WriterMask = (1U << WriterBits) - 1U;
+	inline static constexpr uint32_t GenerationIncrement = 1U << WriterBits;
+
+	std::atomic<uint32_t> state{0};
+
+public:
+	/**
+	 * Marks the start of an update to the protected data
+	 */
+	void beginWrite() {
+		state.fetch_add(1, std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	/**
+	 * Marks the end of an update started with \ref beginWrite()
+	 */
+	void endWrite() {
+		// Decrease the writer count and increase the generation in a single step
+		state.fetch_add(GenerationIncrement - 1U, std::memory_order_release);
+	}
+
+	/**
+	 * Returns a token to be checked with \ref validateRead(). This never waits for active writers, so that it can be
+	 * called from an interrupt handler.
+	 */
+	uint32_t beginRead() const {
+		return state.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @return True if no writer was active when \ref beginRead() returned \p token, and no write happened since then,
+	 * i.e. the data that was read in the meantime is consistent
+	 */
+	bool validateRead(uint32_t token) const {
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return ((token & WriterMask) == 0U) and (state.load(std::memory_order_relaxed) == token);
+	}
+
+	/**
+	 * Runs \p reader until it observes a consistent state of the protected data, or until it has run
+	 * \p maxAttempts times
+	 *
+	 * @param reader A function that copies the protected data. It can be called more than once, so it must start
+	 * from a clean state each time and must not have side effects other than the copy.
+	 * @return True if the last copy is consistent, false if the attempts ran out while writers were active
+	 */
+	template <typename Reader>
+	bool read(Reader&& reader, uint8_t maxAttempts = DefaultReadAttempts) const {
+		for (uint8_t attempt = 0; attempt < maxAttempts; attempt++) {
+			uint32_t token = beginRead();
+			reader();
+			if (validateRead(token)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
+#endif // ECSS_SERVICES_SEQLOCK_HPP
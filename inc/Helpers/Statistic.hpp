@@ -5,21 +5,34 @@
 #include "ErrorHandler.hpp"
 #include "Service.hpp"
 #include "TimeGetter.hpp"
+#include "etl/span.h"
 #include "etl/vector.h"
 
 /**
  * Class containing all the statistics for every parameter. Includes functions that calculate and append the
  * statistics to messages
+ *
+ * The mean and the standard deviation are accumulated with Welford's method, i.e. the class keeps the running mean and
+ * the sum of squared deviations from it, instead of the sum of squares of the samples. This does not lose precision
+ * when the variance is small compared to the magnitude of the values. Batches of samples, as well as statistics
+ * accumulated separately, are combined using the parallel form of the same method.
  */
 class Statistic {
 public:
 	uint16_t selfSamplingInterval = 0;
-	uint16_t sampleCounter = 0;
+	/**
+	 * The number of samples. It is 64 bits wide, so that it cannot wrap around during a mission, even when many
+	 * statistics are merged.
+	 */
+	uint64_t sampleCounter = 0;
 	Time::CustomCUC_t timeOfMaxValue;
 	Time::CustomCUC_t timeOfMinValue;
 	double max = -std::numeric_limits<double>::infinity();
 	double min = std::numeric_limits<double>::infinity();
-	double sumOfSquares = 0;
+	/**
+	 * The sum of the squared differences of all samples from their mean
+	 */
+	double sumOfSquaredDeviations = 0;
 	double mean = 0;
 
 	Statistic() = default;
@@ -30,6 +43,31 @@ public:
 	 */
 	void updateStatistics(double value);
 
+	/**
+	 * Updates the statistics with a batch of samples at once.
+	 *
+	 * This is faster than calling \ref updateStatistics(double) for each sample, since the minimum, maximum and sum of
+	 * the batch are found in branchless loops that the compiler can vectorise, and the mean and deviation of the batch
+	 * are merged into the existing statistics only once. The current time is never read.
+	 *
+	 * @param values The sampled values, in the order they were sampled
+	 * @param timestamps The time at which each value was sampled. It must have the same size as \p values.
+	 */
+	void updateStatistics(etl::span<const double> values, etl::span<const Time::CustomCUC_t> timestamps);
+
+	/**
+	 * Combines the statistics of \p other into this object, as if all samples of \p other had been added here. This
+	 * allows statistics to be accumulated separately, e.g. by different threads, and then reported together.
+	 *
+	 * @note The time of an extreme value that appears in both statistics is taken from this object
+	 */
+	void merge(const Statistic& other);
+
+	/**
+	 * @return The standard deviation of all samples, or 0 if there are no samples
+	 */
+	double standardDeviation() const;
+
 	/**
 	 * Resets all statistics calculated to default values
 	 */
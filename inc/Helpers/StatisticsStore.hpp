@@ -0,0 +1,296 @@
+#ifndef ECSS_SERVICES_STATISTICSSTORE_HPP
+#define ECSS_SERVICES_STATISTICSSTORE_HPP
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include "ECSS_Definitions.hpp"
+#include "ErrorHandler.hpp"
+#include "Helpers/Statistic.hpp"
+#include "Message.hpp"
+#include "TimeGetter.hpp"
+#include "etl/array.h"
+#include "etl/span.h"
+
+/**
+ * The statistics of all parameters monitored by ST[04], stored as a structure of arrays.
+ *
+ * Every statistic occupies the same index in a set of parallel arrays (one for the maxima, one for the means, etc.),
+ * and the indices are sorted by parameter ID. Compared to a map of \ref Statistic objects, this:
+ * - has no per-node overhead, so it can hold thousands of definitions in a predictable amount of memory
+ * - finds a parameter with a binary search over a dense array of IDs
+ * - lets operations that touch every statistic, such as resetting, run as tight loops over contiguous arrays
+ * - reports the statistics in ascending order of ID, the same as the map it replaces
+ *
+ * Adding or removing a definition shifts the following entries, which is O(n), but this only happens on request from
+ * the ground. Sampling and reporting are O(log n) and O(1) per statistic respectively.
+ *
+ * @tparam Capacity The max number of statistics
+ */
+template <uint16_t Capacity>
+class StatisticsStore {
+private:
+	etl::array<uint16_t, Capacity> parameterIds;
+	etl::array<uint16_t, Capacity> selfSamplingIntervals;
+	etl::array<uint64_t, Capacity> sampleCounters;
+	etl::array<double, Capacity> maxValues;
+	etl::array<double, Capacity> minValues;
+	etl::array<double, Capacity> means;
+	etl::array<double, Capacity> sumsOfSquaredDeviations;
+	etl::array<Time::CustomCUC_t, Capacity> timesOfMaxValue;
+	etl::array<Time::CustomCUC_t, Capacity> timesOfMinValue;
+
+	uint16_t count = 0;
+
+	/**
+	 * @return The index of the first statistic whose parameter ID is not less than \p parameterId
+	 */
+	uint16_t lowerBound(uint16_t parameterId) const {
+		return std::lower_bound(parameterIds.begin(), parameterIds.begin() + count, parameterId) -
+		       parameterIds.begin();
+	}
+
+	/**
+	 * Moves the entries in [\p first, \p last) to start at \p destination, in all arrays
+	 */
+	void moveEntries(uint16_t first, uint16_t last, uint16_t destination) {
+		auto move = [&](auto& array) {
+			std::copy(array.begin() + first, array.begin() + last, array.begin() + destination);
+		};
+		auto moveBackward = [&](auto& array) {
+			std::copy_backward(array.begin() + first, array.begin() + last,
+			                   array.begin() + destination + (last - first));
+		};
+
+		if (destination < first) {
+			move(parameterIds);
+			move(selfSamplingIntervals);
+			move(sampleCounters);
+			move(maxValues);
+			move(minValues);
+			move(means);
+			move(sumsOfSquaredDeviations);
+			move(timesOfMaxValue);
+			move(timesOfMinValue);
+		} else {
+			moveBackward(parameterIds);
+			moveBackward(selfSamplingIntervals);
+			moveBackward(sampleCounters);
+			moveBackward(maxValues);
+			moveBackward(minValues);
+			moveBackward(means);
+			moveBackward(sumsOfSquaredDeviations);
+			moveBackward(timesOfMaxValue);
+			moveBackward(timesOfMinValue);
+		}
+	}
+
+	/**
+	 * Gathers the statistic stored at \p index, applies \p modifier to it and stores it back, so that all updates go
+	 * through the same routines of \ref Statistic
+	 */
+	template <typename Modifier>
+	void modify(uint16_t index, Modifier&& modifier) {
+		Statistic statistic = get(index);
+		modifier(statistic);
+		set(index, statistic);
+	}
+
+public:
+	/**
+	 * The number of bytes that a statistic with samples occupies in a TM[4,2] report
+	 */
+	inline static constexpr uint16_t ReportedStatisticSize =
+	    2 * sizeof(uint16_t) + 3 * sizeof(float) + 2 * sizeof(uint64_t) + (SupportsStandardDeviation ? sizeof(float) : 0);
+
+	/**
+	 * @return The number of statistics
+	 */
+	uint16_t size() const {
+		return count;
+	}
+
+	bool empty() const {
+		return count == 0;
+	}
+
+	bool full() const {
+		return count == Capacity;
+	}
+
+	/**
+	 * Finds the index of the statistic of a parameter. The index stays valid until a statistic is added or removed.
+	 *
+	 * @return The index, or nothing if there is no statistic for \p parameterId
+	 */
+	std::optional<uint16_t> findIndex(uint16_t parameterId) const {
+		uint16_t index = lowerBound(parameterId);
+		if (index == count or parameterIds[index] != parameterId) {
+			return {};
+		}
+		return index;
+	}
+
+	bool contains(uint16_t parameterId) const {
+		return findIndex(parameterId).has_value();
+	}
+
+	/**
+	 * Adds the statistic of a parameter, keeping the IDs sorted
+	 *
+	 * @return False if the parameter already has a statistic, or the store is full
+	 */
+	bool insert(uint16_t parameterId, const Statistic& statistic = Statistic()) {
+		uint16_t index = lowerBound(parameterId);
+		if (index < count and parameterIds[index] == parameterId) {
+			return false;
+		}
+		if (full()) {
+			ErrorHandler::reportInternalError(ErrorHandler::MapFull);
+			return false;
+		}
+
+		moveEntries(index, count, index + 1);
+		count++;
+		parameterIds[index] = parameterId;
+		set(index, statistic);
+		return true;
+	}
+
+	/**
+	 * Removes the statistic of a parameter, if it exists
+	 */
+	void erase(uint16_t parameterId) {
+		if (auto index = findIndex(parameterId)) {
+			moveEntries(*index + 1, count, *index);
+			count--;
+		}
+	}
+
+	void clear() {
+		count = 0;
+	}
+
+	uint16_t getParameterId(uint16_t index) const {
+		return parameterIds[index];
+	}
+
+	uint64_t getSampleCounter(uint16_t index) const {
+		return sampleCounters[index];
+	}
+
+	uint16_t getSelfSamplingInterval(uint16_t index) const {
+		return selfSamplingIntervals[index];
+	}
+
+	void setSelfSamplingInterval(uint16_t index, uint16_t samplingInterval) {
+		selfSamplingIntervals[index] = samplingInterval;
+	}
+
+	/**
+	 * Gathers the statistic stored at \p index into a separate object
+	 */
+	Statistic get(uint16_t index) const {
+		Statistic statistic;
+		statistic.selfSamplingInterval = selfSamplingIntervals[index];
+		statistic.sampleCounter = sampleCounters[index];
+		statistic.max = maxValues[index];
+		statistic.min = minValues[index];
+		statistic.mean = means[index];
+		statistic.sumOfSquaredDeviations = sumsOfSquaredDeviations[index];
+		statistic.timeOfMaxValue = timesOfMaxValue[index];
+		statistic.timeOfMinValue = timesOfMinValue[index];
+		return statistic;
+	}
+
+	/**
+	 * Replaces the statistic stored at \p index
+	 */
+	void set(uint16_t index, const Statistic& statistic) {
+		selfSamplingIntervals[index] = statistic.selfSamplingInterval;
+		sampleCounters[index] = statistic.sampleCounter;
+		maxValues[index] = statistic.max;
+		minValues[index] = statistic.min;
+		means[index] = statistic.mean;
+		sumsOfSquaredDeviations[index] = statistic.sumOfSquaredDeviations;
+		timesOfMaxValue[index] = statistic.timeOfMaxValue;
+		timesOfMinValue[index] = statistic.timeOfMinValue;
+	}
+
+	/**
+	 * The equivalent of \ref Statistic::updateStatistics(double) for the statistic stored at \p index
+	 */
+	void updateStatistics(uint16_t index, double value) {
+		modify(index, [value](Statistic& statistic) { statistic.updateStatistics(value); });
+	}
+
+	/**
+	 * The equivalent of \ref Statistic::updateStatistics(etl::span<const double>, etl::span<const Time::CustomCUC_t>)
+	 * for the statistic stored at \p index
+	 */
+	void updateStatistics(uint16_t index, etl::span<const double> values,
+	                      etl::span<const Time::CustomCUC_t> timestamps) {
+		modify(index, [&](Statistic& statistic) { statistic.updateStatistics(values, timestamps); });
+	}
+
+	/**
+	 * The equivalent of \ref Statistic::merge() for the statistic stored at \p index
+	 */
+	void merge(uint16_t index, const Statistic& other) {
+		modify(index, [&](Statistic& statistic) { statistic.merge(other); });
+	}
+
+	/**
+	 * Clears the samples of all statistics, keeping their definitions
+	 */
+	void resetStatistics() {
+		std::fill(sampleCounters.begin(), sampleCounters.begin() + count, 0);
+		std::fill(maxValues.begin(), maxValues.begin() + count, -std::numeric_limits<double>::infinity());
+		std::fill(minValues.begin(), minValues.begin() + count, std::numeric_limits<double>::infinity());
+		std::fill(means.begin(), means.begin() + count, 0);
+		std::fill(sumsOfSquaredDeviations.begin(), sumsOfSquaredDeviations.begin() + count, 0);
+		std::fill(timesOfMaxValue.begin(), timesOfMaxValue.begin() + count, Time::CustomCUC_t{});
+		std::fill(timesOfMinValue.begin(), timesOfMinValue.begin() + count, Time::CustomCUC_t{});
+	}
+
+	/**
+	 * Clears the samples of the statistic stored at \p index, keeping its definition
+	 */
+	void resetStatistics(uint16_t index) {
+		uint16_t samplingInterval = selfSamplingIntervals[index];
+		set(index, Statistic());
+		selfSamplingIntervals[index] = samplingInterval;
+	}
+
+	/**
+	 * Appends the statistics that have samples to a TM[4,2] report, starting from \p firstIndex, until the end of the
+	 * store or until the report has no space for another statistic. Each statistic is preceded by its parameter ID and
+	 * number of samples. The number of samples is a 16-bit field, so larger counts are reported as its max value.
+	 *
+	 * @param[out] appendedStatistics The number of statistics appended
+	 * @return The index to continue from in the next report, which is equal to \ref size() if all statistics were
+	 * appended
+	 */
+	uint16_t appendStatisticsToMessage(uint16_t firstIndex, Message& report, uint16_t& appendedStatistics) const {
+		appendedStatistics = 0;
+
+		uint16_t index = firstIndex;
+		for (; index < count; index++) {
+			if (sampleCounters[index] == 0) {
+				continue;
+			}
+			if (report.dataSize + ReportedStatisticSize > ECSSMaxMessageSize) {
+				break;
+			}
+
+			report.appendUint16(parameterIds[index]);
+			report.appendUint16(static_cast<uint16_t>(std::min<uint64_t>(sampleCounters[index], UINT16_MAX)));
+			get(index).appendStatisticsToMessage(report);
+			appendedStatistics++;
+		}
+
+		return index;
+	}
+};
+
+#endif // ECSS_SERVICES_STATISTICSSTORE_HPP
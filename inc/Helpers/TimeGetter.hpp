@@ -8,19 +8,64 @@
 
 /**
  * @brief Get the current time
+ *
+ * The time is read from a single monotonic source, in nanoseconds elapsed since the @ref Time::Epoch, and all other
+ * formats are derived from it. The source is the clock of the platform, unless another one is set with
+ * \ref setClockSource(), e.g. a \ref SimulatedClock that lets tests run faster than real time.
  */
 class TimeGetter {
 public:
+	/**
+	 * A function that returns the nanoseconds elapsed since the @ref Time::Epoch. The returned values must never
+	 * decrease.
+	 */
+	using ClockSource = uint64_t (*)();
+
+	inline static constexpr uint64_t NanosecondsPerSecond = 1000000000;
+
+	inline static constexpr uint64_t NanosecondsPerMillisecond = 1000000;
+
+	/**
+	 * The duration of one tick of the custom CUC format, in nanoseconds
+	 */
+	inline static constexpr uint64_t NanosecondsPerTick = 100000000;
+
+private:
+	inline static ClockSource clockSource = nullptr;
+
+public:
+	/**
+	 * Returns the nanoseconds elapsed since the @ref Time::Epoch, according to the monotonic clock of the platform.
+	 * @note
+	 * This function is implementation-specific, and should be cheap enough to be called on every timestamp.
+	 */
+	static uint64_t getPlatformTime();
+
+	/**
+	 * Replaces the source of the current time
+	 *
+	 * @param source The new source, or nullptr to return to the clock of the platform
+	 */
+	static void setClockSource(ClockSource source) {
+		clockSource = source;
+	}
+
+	/**
+	 * @return The nanoseconds elapsed since the @ref Time::Epoch
+	 */
+	static uint64_t now() {
+		return (clockSource != nullptr) ? clockSource() : getPlatformTime();
+	}
+
 	/**
 	 * Returns the current UTC time.
 	 * @note
-	 * The information needed to compute the UTC time is implementation-specific. This function should
-	 * be reimplemented to work for every format of the time-related parameters.
+	 * Leap seconds are not taken into account.
 	 */
 	static UTCTimestamp getCurrentTimeUTC();
 
 	/**
-	 * Converts the current UTC time, to a CUC formatted timestamp.
+	 * Converts the current time, to a CUC formatted timestamp.
 	 * @note
 	 * The original format of the CUC (etl array of bits), is not used here, because it's easier to append
 	 * a type uint64_t to a message object, rather than a whole array. Thus, we use the custom CUC format.
@@ -28,7 +73,57 @@ public:
 	 * @return CUC timestamp, formatted as elapsed 100ms ticks.
 	 * @see Time.hpp
 	 */
-	static Time::CustomCUC_t getCurrentTimeCustomCUC();
+	static Time::CustomCUC_t getCurrentTimeCustomCUC() {
+		return {now() / NanosecondsPerTick};
+	}
+
+	/**
+	 * Returns the current time as an encoded CUC timestamp. The encoding is cached, so it is only computed once per
+	 * tick of the custom CUC format, no matter how many times this is called.
+	 *
+	 * @tparam secondsBytes The number of bytes of the basic time units of the timestamp
+	 * @tparam fractionalBytes The number of bytes of the fractional time units of the timestamp
+	 */
+	template <uint8_t secondsBytes = Time::CUCSecondsBytes, uint8_t fractionalBytes = Time::CUCFractionalBytes>
+	static const etl::array<uint8_t, Time::CUCTimestampMaximumSize>& getCurrentTimeCUC() {
+		static Time::CustomCUC_t cachedTime{UINT64_MAX};
+		static etl::array<uint8_t, Time::CUCTimestampMaximumSize> cachedTimestamp;
+
+		Time::CustomCUC_t currentTime = getCurrentTimeCustomCUC();
+		if (not(currentTime == cachedTime)) {
+			cachedTimestamp = TimeStamp<secondsBytes, fractionalBytes>(currentTime).toCUCtimestamp();
+			cachedTime = currentTime;
+		}
+		return cachedTimestamp;
+	}
+};
+
+/**
+ * A clock that only advances when told to, to be used as the source of \ref TimeGetter in tests and simulations
+ *
+ * @code
+ * TimeGetter::setClockSource(SimulatedClock::now);
+ * SimulatedClock::advance(10 * TimeGetter::NanosecondsPerSecond);
+ * @endcode
+ */
+class SimulatedClock {
+	inline static uint64_t currentTime = 0;
+
+public:
+	/**
+	 * @return The nanoseconds elapsed since the @ref Time::Epoch
+	 */
+	static uint64_t now() {
+		return currentTime;
+	}
+
+	static void set(uint64_t nanoseconds) {
+		currentTime = nanoseconds;
+	}
+
+	static void advance(uint64_t nanoseconds) {
+		currentTime += nanoseconds;
+	}
 };
 
 #endif // ECSS_SERVICES_TIMEGETTER_HPP
@@ -0,0 +1,207 @@
+#ifndef ECSS_SERVICES_WINDOWEDSTATISTIC_HPP
+#define ECSS_SERVICES_WINDOWEDSTATISTIC_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include "ECSS_Definitions.hpp"
+#include "Helpers/DeadlineScheduler.hpp"
+#include "Helpers/QuantileSketch.hpp"
+#include "etl/array.h"
+#include "etl/deque.h"
+
+/**
+ * Statistics of the most recent samples of a parameter, as opposed to \ref Statistic, which covers all samples since
+ * the last reset.
+ *
+ * The window holds at most \p WindowSize samples. If a max age is set, samples older than that are also dropped. The
+ * statistics of the window are kept up to date as samples enter and leave it:
+ * - The minimum and maximum are found with monotonic deques, i.e. queues of the samples that can still become the
+ * minimum or maximum of the window. Each sample is pushed and popped at most once, so updates are O(1) amortised.
+ * - The mean and standard deviation are updated with Welford's method, which can also remove samples.
+ * - Percentiles are estimated by a \ref QuantileSketch, from which expired samples are removed.
+ *
+ * @tparam WindowSize The max number of samples in the window
+ */
+template <uint16_t WindowSize = ECSSStatisticWindowSize>
+class WindowedStatistic {
+private:
+	struct Sample {
+		double value;
+		uint32_t time;
+	};
+
+	/**
+	 * A ring buffer with the samples of the window. The sample with sequence number `n` is stored at `n % WindowSize`.
+	 */
+	etl::array<Sample, WindowSize> samples = {};
+
+	/**
+	 * The sequence number of the next sample to be added
+	 */
+	uint32_t nextSequence = 0;
+
+	/**
+	 * The number of samples in the window
+	 */
+	uint16_t count = 0;
+
+	/**
+	 * The sequence numbers of the samples that may become the maximum of the window, in decreasing order of value
+	 */
+	etl::deque<uint32_t, WindowSize> maxCandidates;
+
+	/**
+	 * The sequence numbers of the samples that may become the minimum of the window, in increasing order of value
+	 */
+	etl::deque<uint32_t, WindowSize> minCandidates;
+
+	double mean = 0;
+	double sumOfSquaredDeviations = 0;
+
+	QuantileSketch<> sketch;
+
+	const Sample& sample(uint32_t sequence) const {
+		return samples[sequence % WindowSize];
+	}
+
+	/**
+	 * Removes the oldest sample of the window
+	 */
+	void removeOldest() {
+		uint32_t oldest = nextSequence - count;
+		double value = sample(oldest).value;
+
+		if (not maxCandidates.empty() and maxCandidates.front() == oldest) {
+			maxCandidates.pop_front();
+		}
+		if (not minCandidates.empty() and minCandidates.front() == oldest) {
+			minCandidates.pop_front();
+		}
+		sketch.remove(value);
+
+		count--;
+		if (count == 0) {
+			mean = 0;
+			sumOfSquaredDeviations = 0;
+			return;
+		}
+		double deviation = value - mean;
+		mean -= deviation / count;
+		sumOfSquaredDeviations = std::max(sumOfSquaredDeviations - deviation * (value - mean), 0.0);
+	}
+
+public:
+	/**
+	 * The max age of a sample in the window, in milliseconds. If 0, samples only leave the window when it is full.
+	 */
+	uint32_t maxAge = 0;
+
+	WindowedStatistic() = default;
+
+	explicit WindowedStatistic(uint32_t maxAge) : maxAge(maxAge) {}
+
+	/**
+	 * Adds a sample to the window, after removing the samples that expire at \p time
+	 *
+	 * @param time The time at which the value was sampled, in milliseconds. All samples of a window must use the same
+	 * clock.
+	 */
+	void addSample(double value, uint32_t time) {
+		expire(time);
+		if (count == WindowSize) {
+			removeOldest();
+		}
+
+		while (not maxCandidates.empty() and sample(maxCandidates.back()).value <= value) {
+			maxCandidates.pop_back();
+		}
+		maxCandidates.push_back(nextSequence);
+		while (not minCandidates.empty() and sample(minCandidates.back()).value >= value) {
+			minCandidates.pop_back();
+		}
+		minCandidates.push_back(nextSequence);
+
+		samples[nextSequence % WindowSize] = {value, time};
+		nextSequence++;
+		count++;
+
+		double deviation = value - mean;
+		mean += deviation / count;
+		sumOfSquaredDeviations += deviation * (value - mean);
+		sketch.add(value);
+	}
+
+	/**
+	 * Removes the samples that are older than \ref maxAge at \p currentTime
+	 */
+	void expire(uint32_t currentTime) {
+		if (maxAge == 0) {
+			return;
+		}
+		while (count > 0 and DeadlineScheduler<1>::isDue(sample(nextSequence - count).time + maxAge, currentTime)) {
+			removeOldest();
+		}
+	}
+
+	/**
+	 * Removes all samples
+	 */
+	void reset() {
+		count = 0;
+		maxCandidates.clear();
+		minCandidates.clear();
+		mean = 0;
+		sumOfSquaredDeviations = 0;
+		sketch.clear();
+	}
+
+	/**
+	 * @return The number of samples in the window
+	 */
+	uint16_t size() const {
+		return count;
+	}
+
+	/**
+	 * @return The largest sample in the window, or -infinity if the window is empty
+	 */
+	double getMax() const {
+		if (maxCandidates.empty()) {
+			return -std::numeric_limits<double>::infinity();
+		}
+		return sample(maxCandidates.front()).value;
+	}
+
+	/**
+	 * @return The smallest sample in the window, or infinity if the window is empty
+	 */
+	double getMin() const {
+		if (minCandidates.empty()) {
+			return std::numeric_limits<double>::infinity();
+		}
+		return sample(minCandidates.front()).value;
+	}
+
+	double getMean() const {
+		return mean;
+	}
+
+	double getStandardDeviation() const {
+		if (count == 0) {
+			return 0;
+		}
+		return std::sqrt(sumOfSquaredDeviations / count);
+	}
+
+	/**
+	 * Estimates a percentile of the samples in the window, e.g. `getPercentile(95)` for the 95th percentile
+	 *
+	 * @param percentile A value between 0 and 100
+	 */
+	double getPercentile(double percentile) const {
+		return sketch.getQuantile(percentile / 100);
+	}
+};
+
+#endif // ECSS_SERVICES_WINDOWEDSTATISTIC_HPP
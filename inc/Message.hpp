@@ -416,6 +416,32 @@ public:
 	 */
 	void appendMessage(const Message& message, uint16_t size);
 
+	/**
+	 * Reserves space at the end of the message for a field whose value is not known yet, such as the number of
+	 * entries in a report that is built in a single pass. The reserved bytes are zeroed, and should be filled in later
+	 * using one of the `patch...` functions.
+	 *
+	 * @param size The number of bytes to reserve
+	 * @return The position of the reserved field in the message data
+	 */
+	uint16_t reserveBytes(uint16_t size);
+
+	/**
+	 * Overwrites a previously reserved 1-byte field of the message
+	 *
+	 * @param position The position of the field, as returned by Message::reserveBytes()
+	 * @param value The value to write
+	 */
+	void patchUint8(uint16_t position, uint8_t value);
+
+	/**
+	 * Overwrites a previously reserved 2-byte field of the message
+	 *
+	 * @param position The position of the field, as returned by Message::reserveBytes()
+	 * @param value The value to write
+	 */
+	void patchUint16(uint16_t position, uint16_t value);
+
 	/**
 	 * Fetches a single-byte boolean value from the current position in the message
 	 *
@@ -562,7 +588,7 @@ public:
 		return reinterpret_cast<float&>(value);
 	}
 
-	float readDouble() {
+	double readDouble() {
 		static_assert(sizeof(uint64_t) == sizeof(double), "Double numbers must be 64 bits long");
 
 		uint64_t value = readUint64();
@@ -1,6 +1,7 @@
 #ifndef ECSS_SERVICES_MESSAGEPARSER_HPP
 #define ECSS_SERVICES_MESSAGEPARSER_HPP
 
+#include <optional>
 #include <Services/EventActionService.hpp>
 #include "Message.hpp"
 
@@ -67,6 +68,15 @@ public:
 	 */
 	static Message parseECSSTC(uint8_t* data);
 
+	/**
+	 * @brief Overloaded version of \ref MessageParser::parseECSSTC(String<ECSS_TC_REQUEST_STRING_SIZE> data), for TC
+	 * packets of any length
+	 * @param data A uint8_t array of the TC packet data
+	 * @param length The number of bytes of the TC packet, including its header
+	 * @return Parsed message, or nothing if the header is not valid. The error has already been reported.
+	 */
+	static std::optional<Message> parseECSSTC(const uint8_t* data, uint16_t length);
+
 	/**
 	 * @brief Converts a TC or TM message to a message string, appending just the ECSS header
 	 * @todo Add time reference, as soon as it is available and the format has been specified
@@ -93,8 +103,9 @@ private:
 	 * @param data The data of the header (not null-terminated)
 	 * @param length The size of the header
 	 * @param message The Message to modify based on the header
+	 * @return Whether the header is valid. If not, an error has been reported and \p message is not modified.
 	 */
-	static void parseECSSTCHeader(const uint8_t* data, uint16_t length, Message& message);
+	static bool parseECSSTCHeader(const uint8_t* data, uint16_t length, Message& message);
 
 	/**
 	 * Parse the ECSS Telemetry packet secondary header
@@ -1,10 +1,14 @@
 #ifndef ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 #define ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 
+#include <optional>
 #include "Service.hpp"
 #include "etl/String.hpp"
 #include "Services/EventReportService.hpp"
-#include "etl/multimap.h"
+#include "etl/array.h"
+#include "etl/bitset.h"
+#include "etl/deque.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of ST[19] event-action Service
@@ -20,23 +24,74 @@
  * definition
  * @attention Every event action definition ID should be different, regardless of the application ID
  *
- * @todo Since there are multiple actions per event and in delete/enable/disable functions are
- * multiple instances are accessed, should I find a more efficient way to access them?
+ * @note The definitions are stored in a pool, and a table indexed by event definition ID lists the definitions of
+ * each event, so that raising an event finds its actions without any search. The TC of each definition is parsed
+ * once, when the definition is added, so that executing an action does not need to parse it again.
+ *
+ * @note Raising an event does not execute its actions. They are placed in a queue, which is emptied by
+ * executePendingActions(), so that TCs are never executed from inside the event report that triggered them. This
+ * function must be called periodically by the platform, e.g. from its main loop.
+ *
  * @todo check if eventActionFunctionStatus should be private or not
  * @todo check if eventAction map of definitions should be private or not
  */
 class EventActionService : public Service {
 private:
+	static_assert(ECSSEventActionEventDefinitionCount <= ECSSEventDefinitionCount,
+	              "Event-actions cannot be defined for events that do not exist");
+
 	/**
 	 * Event-action function status
 	 */
 	bool eventActionFunctionStatus;
 
 	/**
-	 * Custom function that is called right after an event takes place, to initiate
-	 * the execution of the action
+	 * An event-action waiting in the queue to be executed
+	 */
+	struct QueuedAction {
+		uint16_t eventDefinitionID;
+		uint16_t eventActionDefinitionID;
+		uint32_t queueTime; ///< The value of \ref currentTime when the action was queued, in milliseconds
+	};
+
+	/**
+	 * The actions of raised events that have not been executed yet, in the order they were raised
+	 */
+	etl::deque<QueuedAction, ECSSEventActionQueueSize> actionQueue;
+
+	/**
+	 * The time of the latest call to \ref executePendingActions(), in milliseconds. Raising an event does not read
+	 * the clock, so this is used as the time at which an event was raised, with a precision of one call period.
+	 */
+	uint32_t currentTime = 0;
+
+	/**
+	 * The time before which the actions of each event will not be queued again, indexed by event definition ID. It
+	 * is only valid for the events whose bit is set in \ref isEventRateLimited.
+	 */
+	etl::array<uint32_t, ECSSEventActionEventDefinitionCount> nextAllowedEventTime = {};
+
+	/**
+	 * Whether each event has an entry in \ref nextAllowedEventTime
 	 */
-	void executeAction(uint16_t eventID);
+	etl::bitset<ECSSEventActionEventDefinitionCount> isEventRateLimited;
+
+	/**
+	 * The positions in \ref eventActionDefinitions of the definitions of each event, indexed by event definition ID
+	 */
+	etl::array<etl::vector<uint16_t, ECSSMaxEventActionsPerEvent>, ECSSEventActionEventDefinitionCount>
+	    definitionsOfEvent;
+
+	/**
+	 * @return The position of a definition in \ref eventActionDefinitions, or nothing if it does not exist
+	 */
+	std::optional<uint16_t> findDefinitionIndex(uint16_t eventDefinitionID, uint16_t eventActionDefinitionID) const;
+
+	/**
+	 * Removes the definition at position \p index of \ref eventActionDefinitions. The last definition takes its
+	 * place, so the positions of the other definitions are kept.
+	 */
+	void removeDefinition(uint16_t index);
 
 public:
 
@@ -54,19 +109,56 @@ public:
 		DisableEventActionFunction = 9
 	};
 
+	/**
+	 * The TC of an event-action definition, already separated from its packet header
+	 */
+	struct ParsedRequest {
+		uint8_t serviceType = 0;
+		uint8_t messageType = 0;
+		uint8_t dataSize = 0;
+		etl::array<uint8_t, ECSSTCRequestStringSize> data = {};
+
+		/**
+		 * @return A TC message, ready to be executed
+		 */
+		Message toMessage() const;
+	};
+
 	struct EventActionDefinition {
 		// TODO: APID = 0 is the Ground Station APID. This should be changed
 		uint16_t applicationId = 0;
 		uint16_t eventDefinitionID = 65535; // The ID of the event that might take place
 		uint16_t eventActionDefinitionID = 0; // The ID of the event-action
-		String<64> request = "";
+		ParsedRequest request;
 		bool enabled = false;
+		bool pending = false; // Whether the action is in the queue, waiting to be executed
+	};
+
+	/**
+	 * Counters that describe the operation of the action queue
+	 */
+	struct ActionQueueStatistics {
+		uint16_t maxQueueDepth = 0; ///< The max number of actions that were waiting in the queue at the same time
+		uint32_t executedActions = 0;
+		uint32_t droppedActions = 0; ///< Actions that were not queued because the queue was full
+		uint32_t rateLimitedEvents = 0; ///< Events whose actions were not queued due to \ref minimumEventInterval
+		uint32_t coalescedActions = 0; ///< Actions that were not queued because they were already in the queue
+		uint32_t maxLatency = 0; ///< The max time between raising an event and executing an action, in milliseconds
+		uint64_t totalLatency = 0; ///< The sum of the latencies of all executed actions, in milliseconds
 	};
 
 	friend EventReportService;
 
-	etl::multimap<uint16_t, EventActionDefinition, ECSSEventActionStructMapSize>
-		eventActionDefinitionMap;
+	/**
+	 * The event-action definitions of all events, in no particular order
+	 */
+	etl::vector<EventActionDefinition, ECSSEventActionStructMapSize> eventActionDefinitions;
+
+	/**
+	 * The min time between two occurrences of the same event that trigger its actions, in milliseconds. The actions
+	 * of an event that is raised again within this interval are not queued. If 0, every occurrence triggers them.
+	 */
+	uint32_t minimumEventInterval = 0;
 
 	EventActionService() {
 		serviceType = 19;
@@ -79,6 +171,8 @@ public:
 	 * Note: We have abolished multiple additions in one Telecommand packet. Only one
 	 * event-action definition will be added per TC packet. That means there will be just an
 	 * application ID, an event definition ID and the TC request.
+	 *
+	 * The TC request is parsed at this point, and the definition is rejected if it is not a valid TC.
 	 */
 	void addEventActionDefinitions(Message& message);
 
@@ -122,6 +216,14 @@ public:
 	 */
 	void disableEventActionFunction(Message& message);
 
+	/**
+	 * @return The definition with the given IDs, or nullptr if it does not exist
+	 */
+	EventActionDefinition* findEventActionDefinition(uint16_t eventDefinitionID, uint16_t eventActionDefinitionID) {
+		auto index = findDefinitionIndex(eventDefinitionID, eventActionDefinitionID);
+		return index ? &eventActionDefinitions[*index] : nullptr;
+	}
+
 	/**
 	 * Setter for event-action function status
 	 */
@@ -137,6 +239,38 @@ public:
 		return eventActionFunctionStatus;
 	}
 
+	/**
+	 * Called right after an event takes place, to queue its enabled actions for execution. This is normally called by
+	 * \ref EventReportService.
+	 */
+	void queueActions(uint16_t eventID);
+
+	/**
+	 * Executes the queued actions, in the order their events were raised. An action whose definition was deleted or
+	 * disabled after being queued is discarded. Actions that are queued while this function runs, by the TCs it
+	 * executes, wait for the next call.
+	 *
+	 * @param time The current system time, in milliseconds
+	 * @param maxActions The max number of actions to execute. The rest stay in the queue for the next call.
+	 * @return The number of executed actions
+	 */
+	uint16_t executePendingActions(uint32_t time, uint16_t maxActions = ECSSMaxEventActionsPerCall);
+
+	/**
+	 * @return The number of actions waiting in the queue
+	 */
+	uint16_t getQueueDepth() const {
+		return actionQueue.size();
+	}
+
+	const ActionQueueStatistics& getActionQueueStatistics() const {
+		return actionQueueStatistics;
+	}
+
+	void resetActionQueueStatistics() {
+		actionQueueStatistics = ActionQueueStatistics();
+	}
+
 	/**
 	 * It is responsible to call the suitable function that executes a telecommand packet. The source of that packet
 	 * is the ground station.
@@ -145,6 +279,9 @@ public:
 	 * @param message Contains the necessary parameters to call the suitable subservice
 	 */
 	void execute(Message& message);
+
+private:
+	ActionQueueStatistics actionQueueStatistics;
 };
 
 #endif // ECSS_SERVICES_EVENTACTIONSERVICE_HPP
@@ -3,6 +3,7 @@
 
 #include "Service.hpp"
 #include <etl/bitset.h>
+#include <etl/vector.h>
 
 /**
  * Implementation of ST[05] event reporting service
@@ -12,13 +13,61 @@
  * @todo Make sure there isn't an event ID == 0, because there's a confliction with another service
  * Note: enum IDs are these just for test purposes
  *
+ * @note The reports of an event can be throttled with a token bucket, so that a repeating event does not saturate the
+ * downlink. Each report of a throttled event consumes a token, and the tokens are refilled at a fixed rate by
+ * \ref processThrottledEvents(), which must be called periodically by the platform. The occurrences of the event while
+ * there are no tokens are not reported, but they are summarised in a single report when a token becomes available.
  */
 
 class EventReportService : public Service {
+public:
+	/**
+	 * The number of event definition IDs
+	 */
+	static const uint16_t numberOfEvents = ECSSEventDefinitionCount;
+
+	/**
+	 * The max number of event definition IDs that fit in a single TM[5,8] report
+	 */
+	inline static constexpr uint16_t MaxDisabledEventsPerReport =
+	    (ECSSMaxMessageSize - sizeof(uint16_t)) / sizeof(uint16_t);
+
+	/**
+	 * The token bucket of a throttled event, and the occurrences of the event that were not reported
+	 */
+	struct EventThrottle {
+		uint16_t eventID = 0;
+		uint16_t bucketSize = 0; ///< The max number of reports that can be generated in a burst
+		uint32_t tokenInterval = 0; ///< The time to refill one token, in milliseconds
+		uint16_t tokens = 0;
+		uint32_t lastRefillTime = 0;
+		/**
+		 * Whether a summary of the unreported occurrences is generated. If false, they are only counted in
+		 * \ref totalSuppressedOccurrences.
+		 */
+		bool aggregate = true;
+
+		uint32_t suppressedOccurrences = 0; ///< The occurrences since the last report of the event
+		uint32_t firstSuppressedTime = 0;
+		uint32_t lastSuppressedTime = 0;
+		uint8_t suppressedMessageType = 0; ///< The report type of the latest suppressed occurrence
+		uint32_t totalSuppressedOccurrences = 0;
+	};
+
 private:
-	static const uint16_t numberOfEvents = 7;
 	etl::bitset<numberOfEvents> stateOfEvents;
 
+	/**
+	 * The throttled events, sorted by event ID
+	 */
+	etl::vector<EventThrottle, ECSSMaxThrottledEvents> eventThrottles;
+
+	/**
+	 * The time of the latest call to \ref processThrottledEvents(), in milliseconds. It is used as the time of the
+	 * occurrence of an event, with a precision of one call period.
+	 */
+	uint32_t currentTime = 0;
+
 public:
 
 	inline static const uint8_t ServiceType = 5;
@@ -103,7 +152,12 @@ public:
 		/**
 		 * When an execution of a notification/event fails to start
 		 */
-		FailedStartOfExecution = 7
+		FailedStartOfExecution = 7,
+		/**
+		 * Some occurrences of a throttled event were not reported. The auxiliary data contain the ID of that
+		 * event, the number of its unreported occurrences, and the times of the first and last of them.
+		 */
+		SuppressedEventsSummary = 8
 	};
 
 	/**
@@ -173,9 +227,40 @@ public:
 	/**
 	 * TM[5,8] disabled event definitions report
 	 * Telemetry package of a report of the disabled event definitions
+	 *
+	 * The IDs are split across as many reports as needed, each with at most \ref MaxDisabledEventsPerReport of them.
+	 * A single report with no IDs is generated if no event is disabled.
 	 */
 	void listOfDisabledEventsReport();
 
+	/**
+	 * Starts throttling the reports of an event, or changes its throttle. The bucket starts full.
+	 *
+	 * @param bucketSize The max number of reports that can be generated in a burst
+	 * @param tokenInterval The time to refill one token, i.e. the min average time between two reports, in milliseconds
+	 * @param aggregate Whether to generate a summary of the occurrences that were not reported
+	 * @return False if the event ID or the parameters are invalid, or no more events can be throttled
+	 */
+	bool setEventThrottle(uint16_t eventID, uint16_t bucketSize, uint32_t tokenInterval, bool aggregate = true);
+
+	/**
+	 * Stops throttling the reports of an event. Its suppressed occurrences are reported first, if aggregated.
+	 */
+	void removeEventThrottle(uint16_t eventID);
+
+	/**
+	 * @return The throttle of an event, or nullptr if its reports are not throttled
+	 */
+	const EventThrottle* getEventThrottle(uint16_t eventID) const;
+
+	/**
+	 * Refills the tokens of the throttled events, and reports the suppressed occurrences of the events that have a
+	 * token again.
+	 *
+	 * @param time The current system time, in milliseconds
+	 */
+	void processThrottledEvents(uint32_t time);
+
 	/**
 	 * Getter for stateOfEvents bitset
 	 * @return stateOfEvents, just in case the whole bitset is needed
@@ -192,6 +277,34 @@ public:
 	 * @param message Contains the necessary parameters to call the suitable subservice
 	 */
 	void execute(Message& message);
+
+private:
+	EventThrottle* findEventThrottle(uint16_t eventID) {
+		return const_cast<EventThrottle*>(getEventThrottle(eventID));
+	}
+
+	/**
+	 * Adds the tokens that have been refilled since the last refill, up to the size of the bucket
+	 */
+	static void refillTokens(EventThrottle& throttle, uint32_t time);
+
+	/**
+	 * Updates the observables of the reports of a severity level
+	 */
+	void countReport(MessageType messageType, uint16_t eventID);
+
+	/**
+	 * Generates the report of an event occurrence, if the event is enabled and its throttle has a token, and
+	 * queues the actions of the event
+	 *
+	 * @return True if the report was generated
+	 */
+	bool reportEvent(MessageType messageType, Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data);
+
+	/**
+	 * Generates a report that summarises the suppressed occurrences of a throttled event, and clears them
+	 */
+	void suppressedEventsReport(EventThrottle& throttle);
 };
 
 #endif // ECSS_SERVICES_EVENTREPORTSERVICE_HPP
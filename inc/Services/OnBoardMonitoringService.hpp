@@ -8,7 +8,10 @@
 #include "etl/map.h"
 #include "ECSS_Definitions.hpp"
 #include "etl/list.h"
+#include "etl/vector.h"
 #include "Helpers/PMONBase.hpp"
+#include "Helpers/ParameterChangeNotifier.hpp"
+#include "Helpers/PMONDefinitionPool.hpp"
 
 /**
  * Implementation of the ST[12] parameter statistics reporting service, as defined in ECSS-E-ST-70-41C.
@@ -16,11 +19,144 @@
  * @author Konstantinos Michopoulos <konstantinos.michopoulos@gmail.com>
  */
 class OnBoardMonitoringService : public Service {
+public:
+	/**
+	 * A change of the checking status of a definition, waiting to be reported in a TM[12,12]
+	 */
+	struct CheckTransition {
+		uint16_t PMONId;
+		uint16_t monitoredParameterId;
+		PMONBase::CheckType checkType;
+		/**
+		 * The expected value, limit or threshold that was crossed
+		 */
+		double crossedLimit;
+		PMONBase::CheckingStatus previousStatus;
+		PMONBase::CheckingStatus currentStatus;
+		Time::CustomCUC_t transitionTime;
+	};
+
+	/**
+	 * The number of bytes that a check transition occupies in a TM[12,11] or TM[12,12] report
+	 */
+	inline static constexpr uint16_t ReportedTransitionSize =
+	    2 * sizeof(uint16_t) + sizeof(uint8_t) + sizeof(double) + 2 * sizeof(uint8_t) + sizeof(uint64_t);
+
+	/**
+	 * The max number of check transitions that fit in a single TM[12,12] report
+	 */
+	inline static constexpr uint16_t MaxTransitionsPerReport =
+	    (ECSSMaxMessageSize - sizeof(uint16_t)) / ReportedTransitionSize;
+
 private:
 	/**
-	 * Map storing the parameter monitoring definitions.
+	 * The number of definitions of the same check type that are evaluated together in a monitoring cycle
+	 */
+	inline static constexpr uint16_t CheckBatchSize = 32;
+
+	/**
+	 * The parameter monitoring definitions, stored in a separate pool for each check type. A PMON ID is unique across
+	 * all pools.
 	 */
-	etl::map<uint16_t, std::reference_wrapper<PMONBase>, ECSSMaxMonitoringDefinitions> parameterMonitoringList;
+	PMONDefinitionPool<PMONExpectedValueCheck, ECSSMaxExpectedValueCheckDefinitions> expectedValueCheckDefinitions;
+	PMONDefinitionPool<PMONLimitCheck, ECSSMaxLimitCheckDefinitions> limitCheckDefinitions;
+	PMONDefinitionPool<PMONDeltaCheck, ECSSMaxDeltaCheckDefinitions> deltaCheckDefinitions;
+
+	/**
+	 * @return The definition with the given ID, of any check type, or nullptr if it does not exist
+	 */
+	PMONBase* findPMONDefinition(uint16_t PMONId);
+
+	/**
+	 * Reads the current value of the monitored parameter of a definition
+	 *
+	 * @return The value, or nothing if the parameter does not exist
+	 */
+	static std::optional<double> readMonitoredParameter(const PMONBase& definition);
+
+	/**
+	 * Reads the current value of the monitored parameter of an expected value check, with all of its bits
+	 *
+	 * @return The value, or nothing if the parameter does not exist or is not of an integer type
+	 */
+	static std::optional<uint64_t> readMonitoredIntegerParameter(const PMONBase& definition);
+
+	/**
+	 * If true, parameter monitoring is enabled
+	 */
+	bool parameterMonitoringFunctionStatus = false;
+
+	/**
+	 * Restarts the checks of every definition, as done by \ref PMONBase::restartChecks()
+	 */
+	void restartAllChecks();
+
+	/**
+	 * The parameters that changed since the previous monitoring cycle, taken at the start of each cycle
+	 */
+	ParameterChangeNotifier::ChangeSet changedParameters;
+
+	/**
+	 * @return True if the check of \p definition can be skipped in this cycle, since it is settled and its monitored
+	 * parameter has not changed, so the check would give the same result as its current checking status
+	 */
+	bool isCheckUnnecessary(const PMONBase& definition) const;
+
+	/**
+	 * Runs the checks of all enabled definitions of the expected value check type
+	 */
+	void checkExpectedValueDefinitions();
+
+	/**
+	 * Runs the checks of all enabled definitions of the limit check type
+	 */
+	void checkLimitDefinitions();
+
+	/**
+	 * Runs the checks of all enabled definitions of the delta check type
+	 */
+	void checkDeltaDefinitions();
+
+	/**
+	 * The check transitions of all definitions that have not been reported yet
+	 */
+	etl::vector<CheckTransition, MaxTransitionsPerReport> pendingTransitions;
+
+	/**
+	 * The number of monitoring cycles that have been completed since the oldest pending transition
+	 */
+	uint16_t cyclesSinceFirstPendingTransition = 0;
+
+	/**
+	 * The definitions that are currently out of limits, each with the transition that brought it to its current
+	 * checking status. The list is kept up to date on every transition, so that an out-of-limits report does not
+	 * need to visit the other definitions. Its order is arbitrary, and each definition knows its own position through
+	 * \ref PMONBase::outOfLimitsIndex. A definition that goes out of limits while the list is full is not added to it.
+	 */
+	etl::vector<CheckTransition, ECSSMaxOutOfLimitsDefinitions> outOfLimits;
+
+	/**
+	 * Appends a check transition to a TM[12,11] or TM[12,12] report
+	 */
+	static void appendCheckTransition(Message& report, const CheckTransition& transition);
+
+	/**
+	 * Adds, updates or removes the entry of a definition in the out-of-limits list, after a transition of the
+	 * definition
+	 */
+	void updateOutOfLimits(PMONBase& definition, const CheckTransition& transition);
+
+	/**
+	 * Removes the entry of a definition from the out-of-limits list, if it has one
+	 */
+	void removeFromOutOfLimits(PMONBase& definition);
+
+	/**
+	 * Applies the result of a check to a definition. If the checking status changes, the transition is queued for the
+	 * next TM[12,12], and the event of the new checking status is raised.
+	 */
+	template <typename Definition>
+	void processCheckResult(uint16_t PMONId, Definition& definition, PMONBase::CheckingStatus result);
 
 public:
 	inline static const uint8_t ServiceType = 12;
@@ -38,35 +174,57 @@ public:
 		OutOfLimitsReport = 11,
 		CheckTransitionReport = 12,
 		ReportStatusOfParameterMonitoringDefinition = 13,
-		ParameterMonitoringDefinitionStatusReport = 14
+		ParameterMonitoringDefinitionStatusReport = 14,
+		EnableParameterMonitoringFunction = 15,
+		DisableParameterMonitoringFunction = 16
 	};
 	/**
 	 * The maximum time between two transition reports.
-	 * Measured in "on-board parameter minimum sampling interval" units (see 5.4.3.2c in ECSS-E-ST-70-41C).
+	 * Measured in "on-board parameter minimum sampling interval" units (see 5.4.3.2c in ECSS-E-ST-70-41C), i.e. in
+	 * calls to \ref checkParameters(). If 0, transitions are reported at the end of the cycle that detected them.
 	 */
 	uint16_t maximumTransitionReportingDelay = 0;
+
 	/**
-	 * If true, parameter monitoring is enabled
+	 * @return True if the parameter monitoring function is enabled, i.e. if \ref checkParameters() checks the
+	 * definitions
 	 */
-	bool parameterMonitoringFunctionStatus = false;
-	/*
-	 * Adds a new Parameter Monitoring definition to the parameter monitoring list.
-	 */
-	void addPMONDefinition(uint16_t PMONId, std::reference_wrapper<PMONBase> PMONDefinition) {
-		parameterMonitoringList.insert({PMONId, PMONDefinition});
+	bool isParameterMonitoringFunctionEnabled() const {
+		return parameterMonitoringFunctionStatus;
 	}
+	/**
+	 * Adds a copy of a Parameter Monitoring definition to the parameter monitoring list.
+	 *
+	 * @return False if a definition with the same ID already exists, or there is no space for another definition of
+	 * the same check type
+	 */
+	bool addPMONDefinition(uint16_t PMONId, const PMONExpectedValueCheck& PMONDefinition);
+	bool addPMONDefinition(uint16_t PMONId, const PMONLimitCheck& PMONDefinition);
+	bool addPMONDefinition(uint16_t PMONId, const PMONDeltaCheck& PMONDefinition);
+
 	/**
 	 * @param PMONId
-	 * @return Parameter Monitoring definition
+	 * @return Parameter Monitoring definition, or nothing if it does not exist
+	 */
+	std::optional<std::reference_wrapper<PMONBase>> getPMONDefinition(uint16_t PMONId) {
+		if (PMONBase* definition = findPMONDefinition(PMONId)) {
+			return *definition;
+		}
+		return {};
+	}
+
+	/**
+	 * @return The total number of Parameter Monitoring definitions
 	 */
-	std::reference_wrapper<PMONBase> getPMONDefinition(uint16_t PMONId) {
-		return parameterMonitoringList.at(PMONId);
+	uint16_t getPMONDefinitionCount() const {
+		return expectedValueCheckDefinitions.size() + limitCheckDefinitions.size() + deltaCheckDefinitions.size();
 	}
+
 	/**
 	 * @return true if PMONList is empty.
 	 */
-	bool isPMONListEmpty() {
-		return parameterMonitoringList.empty();
+	bool isPMONListEmpty() const {
+		return getPMONDefinitionCount() == 0;
 	}
 	/**
 	 * Enables the PMON definitions which correspond to the ids in TC[12,1].
@@ -78,6 +236,20 @@ public:
 	 */
 	void disableParameterMonitoringDefinitions(Message& message);
 
+	/**
+	 * TC[12,15]
+	 * Enables the parameter monitoring function. The checks of all definitions start over, so that no delta or
+	 * repetition collected before the function was disabled is taken into account.
+	 */
+	void enableParameterMonitoringFunction(Message& message);
+
+	/**
+	 * TC[12,16]
+	 * Disables the parameter monitoring function, so that \ref checkParameters() checks nothing until it is enabled
+	 * again
+	 */
+	void disableParameterMonitoringFunction(Message& message);
+
 	/**
 	 * TC[12,3]
 	 * Changes the maximum time between two transition reports.
@@ -90,6 +262,72 @@ public:
 	 */
 	void deleteAllParameterMonitoringDefinitions(Message& message);
 
+	/**
+	 * TC[12,5]
+	 * Adds new PMON definitions to the PMON list. Each definition is given as its PMON ID, the monitored parameter ID,
+	 * the repetition number and the check type, followed by the fields of the check type:
+	 * - expected value check: the mask, the expected value and the unexpected value event
+	 * - limit check: the low limit and its event, followed by the high limit and its event
+	 * - delta check: the low threshold and its event, the high threshold and its event, and the number of consecutive
+	 * delta checks
+	 *
+	 * The monitored parameter of an expected value check must be of an integer type, since its value is masked.
+	 * Invalid definitions are rejected one by one. An unknown check type stops the processing of the request, since the
+	 * size of the following fields is not known.
+	 */
+	void addParameterMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,10]
+	 * Reports the definitions that are currently out of limits in TM[12,11] reports. Each of them is reported with the
+	 * transition that brought it to its current checking status. The definitions are split across as many reports as
+	 * needed.
+	 */
+	void reportOutOfLimits(Message& message);
+
+	/**
+	 * @return The number of definitions that are currently out of limits
+	 */
+	uint16_t getOutOfLimitsCount() const {
+		return outOfLimits.size();
+	}
+
+	/**
+	 * Performs one monitoring cycle, i.e. checks the current value of the monitored parameter of every enabled
+	 * definition. This should be called once per monitoring interval.
+	 *
+	 * The pool of each check type is scanned in batches of \ref CheckBatchSize enabled definitions. The values and the
+	 * limits of a batch are gathered into contiguous arrays, so that all comparisons of the batch run in a single loop,
+	 * and the results are then applied to each definition with the repetition rules of
+	 * \ref PMONBase::applyCheckResult(). Every change of checking status to a violation raises the event configured for
+	 * it. A definition whose monitored parameter does not exist gets an \ref PMONBase::Invalid status.
+	 *
+	 * Expected value and limit checks only depend on the current value of the parameter, so they are skipped for
+	 * settled definitions whose parameter has not changed since the previous cycle, as tracked by the
+	 * \ref ParameterChangeNotifier::Monitoring consumer. Delta checks sample their parameter on every cycle.
+	 *
+	 * @note Nothing is checked while the parameter monitoring function is disabled
+	 */
+	void checkParameters();
+
+	/**
+	 * TM[12,12]
+	 * Reports all pending check transitions in a single message, and empties the queue of pending transitions. Nothing
+	 * is reported if there are no pending transitions.
+	 *
+	 * This is called automatically when the queue is full, or when \ref maximumTransitionReportingDelay monitoring
+	 * cycles have passed since the oldest pending transition, so that a burst of transitions is packed into a few
+	 * reports.
+	 */
+	void checkTransitionReport();
+
+	/**
+	 * @return The number of check transitions that have not been reported yet
+	 */
+	uint16_t getPendingTransitionCount() const {
+		return pendingTransitions.size();
+	}
+
 	void execute(Message& message);
 };
 
@@ -6,7 +6,10 @@
 #include "Service.hpp"
 #include "ErrorHandler.hpp"
 #include "Helpers/Parameter.hpp"
+#include "Helpers/ParameterChangeNotifier.hpp"
+#include "etl/array.h"
 #include "etl/map.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of the ST[20] parameter management service,
@@ -34,6 +37,13 @@ private:
 	 */
 	ParameterMap parameters;
 
+	/**
+	 * The max number of parameter values that fit in a TM[20,2] report, where every value takes at least one byte after
+	 * its ID
+	 */
+	inline static constexpr uint16_t MaxReportedParameters =
+	    (ECSSMaxMessageSize - sizeof(uint16_t)) / (sizeof(uint16_t) + sizeof(uint8_t));
+
 	/**
 	 * Different subsystems should have their own implementations of this function,
 	 * inside the src/Platform directory of their main project.
@@ -43,6 +53,17 @@ private:
 	 */
 	void initializeParameterMap();
 
+	/**
+	 * Keeps track of the parameters that changed since each consumer last processed them
+	 */
+	ParameterChangeNotifier changeNotifier;
+
+	/**
+	 * Assigns a notification index to every parameter of \var parameters, so that its changes are tracked by
+	 * \var changeNotifier
+	 */
+	void registerParameters();
+
 public:
 	inline static const uint8_t ServiceType = 20;
 
@@ -58,6 +79,7 @@ public:
 	 */
 	ParameterService() {
 		initializeParameterMap();
+		registerParameters();
 	}
 
 	/**
@@ -87,6 +109,95 @@ public:
 		}
 	}
 
+	/**
+	 * @return The bit of the lock shard of a parameter, or 0 if the parameter does not exist
+	 * @see ParameterBase::lockShardMask()
+	 */
+	uint32_t lockShardsOf(uint16_t parameterId) const {
+		if (auto parameter = getParameter(parameterId)) {
+			return parameter->get().lockShardMask();
+		}
+		return 0;
+	}
+
+	/**
+	 * Runs \p reader with a consistent view of the values of a set of parameters, i.e. every value that \p reader
+	 * observes was current at the same instant, even if parameters are being updated from other threads.
+	 *
+	 * Writers are never blocked. Instead, \p reader is repeated if a parameter that shares a lock with the parameters
+	 * being read was updated while it ran, so it should only copy the values it needs, and it must restore any state it
+	 * modifies (e.g. the size of a report) before each run. After \ref SeqLock::DefaultReadAttempts runs, the last run
+	 * is kept even if it is inconsistent.
+	 *
+	 * @param lockShards The bits of the lock shards of all parameters that \p reader reads, as combined from
+	 * \ref lockShardsOf()
+	 * @param reader A function with no arguments that reads parameter values
+	 * @return True if the values observed by the last run of \p reader are consistent
+	 */
+	template <typename Reader>
+	bool readConsistently(uint32_t lockShards, Reader&& reader) const {
+		etl::array<uint32_t, ECSSParameterLockShards> tokens;
+
+		for (uint8_t attempt = 0; attempt < SeqLock::DefaultReadAttempts; attempt++) {
+			for (uint8_t shard = 0; shard < ECSSParameterLockShards; shard++) {
+				if ((lockShards & (1UL << shard)) != 0U) {
+					tokens[shard] = ParameterBase::valueLocks[shard].beginRead();
+				}
+			}
+
+			reader();
+
+			bool consistent = true;
+			for (uint8_t shard = 0; shard < ECSSParameterLockShards; shard++) {
+				if ((lockShards & (1UL << shard)) != 0U) {
+					consistent = consistent and ParameterBase::valueLocks[shard].validateRead(tokens[shard]);
+				}
+			}
+			if (consistent) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Marks a parameter as changed for all consumers. This is called by \ref ParameterBase whenever its value changes.
+	 *
+	 * @param notificationIndex The \ref ParameterBase::notificationIndex of the parameter
+	 */
+	void notifyParameterChange(uint16_t notificationIndex) {
+		changeNotifier.notify(notificationIndex);
+	}
+
+	/**
+	 * Adds a function to be called whenever the value of a parameter changes
+	 *
+	 * @param parameterId The PUS ID of the parameter
+	 * @return False if the parameter does not exist or has the maximum number of subscribers
+	 */
+	bool subscribeToParameter(uint16_t parameterId, ParameterChangeNotifier::Callback callback);
+
+	/**
+	 * Visits every parameter that changed since the last time that \p consumer drained its changes. Each change is
+	 * only visited once per consumer, regardless of how many times the parameter changed in the meantime.
+	 *
+	 * @param visitor A function that receives the PUS ID of each changed parameter
+	 */
+	template <typename Visitor>
+	void drainChangedParameters(ParameterChangeNotifier::Consumer consumer, Visitor&& visitor) {
+		changeNotifier.drain(consumer, visitor);
+	}
+
+	/**
+	 * Takes the parameters that changed since the last time that \p consumer drained its changes, and clears them
+	 *
+	 * @return The \ref ParameterBase::notificationIndex of each changed parameter
+	 */
+	ParameterChangeNotifier::ChangeSet takeChangedParameters(ParameterChangeNotifier::Consumer consumer) {
+		return changeNotifier.takeChanges(consumer);
+	}
+
 	/**
 	 * This function receives a TC[20, 1] packet and returns a TM[20, 2] packet
 	 * containing the current configuration
@@ -1,9 +1,13 @@
 #ifndef ECSS_SERVICES_PARAMETERSTATISTICSSERVICE_HPP
 #define ECSS_SERVICES_PARAMETERSTATISTICSSERVICE_HPP
 
+#include <optional>
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
+#include "Helpers/DeadlineScheduler.hpp"
 #include "Helpers/Statistic.hpp"
+#include "Helpers/StatisticsStore.hpp"
+#include "Helpers/WindowedStatistic.hpp"
 #include "Helpers/TimeGetter.hpp"
 #include "Service.hpp"
 #include "etl/deque.h"
@@ -23,6 +27,39 @@ private:
 	 */
 	Time::CustomCUC_t evaluationStartTime;
 
+	/**
+	 * The time at which each parameter with a self-sampling interval is sampled next. The key of each job is the ID of
+	 * the parameter.
+	 */
+	DeadlineScheduler<ECSSMaxStatisticParameters> samplingSchedule;
+
+	/**
+	 * The time given to the latest call of \ref sampleDueStatistics(), in milliseconds. New sampling and reporting
+	 * deadlines are counted from this time.
+	 */
+	uint32_t currentSamplingTime = 0;
+
+	/**
+	 * The time of the next periodic statistics report, if periodic reporting is enabled
+	 */
+	uint32_t nextReportingTime = 0;
+
+	/**
+	 * Starts, restarts or stops the self-sampling of a parameter, according to the sampling interval of its statistic
+	 *
+	 * @param index The index of the statistic in \ref statistics
+	 */
+	void scheduleSampling(uint16_t index);
+
+	/**
+	 * Reads the current value of a parameter, and adds it to its statistic and its windowed statistic, if any. The
+	 * sample of the windowed statistic is stamped with the current time of \ref TimeGetter, so that samples taken by
+	 * \ref updateChangedStatistics() expire at the right time too.
+	 *
+	 * @param index The index of the statistic in \ref statistics
+	 */
+	void sampleParameter(uint16_t index);
+
 public:
 	inline static const uint8_t ServiceType = 4;
 
@@ -41,9 +78,18 @@ public:
 	ParameterStatisticsService();
 
 	/**
-	 * Map containing parameters' IDs followed by the statistics that correspond to the specified parameter
+	 * The statistics of each parameter that has a statistics definition, ordered by parameter ID
+	 */
+	StatisticsStore<ECSSMaxStatisticParameters> statistics;
+
+	/**
+	 * Map containing the rolling statistics of the parameters that have them enabled. Each of these parameters also
+	 * has an entry in \ref statistics, and both are updated with the same samples.
+	 *
+	 * @note The rolling statistics are not included in TM[4,2], which has no fields for them. They are meant for
+	 * on-board consumers, which read them with \ref getWindowedStatistic().
 	 */
-	etl::map<uint16_t, Statistic, ECSSMaxStatisticParameters> statisticsMap;
+	etl::map<uint16_t, WindowedStatistic<>, ECSSMaxWindowedStatistics> windowedStatisticsMap;
 
 	/**
 	 * true means that the periodic statistics reporting is enabled
@@ -62,13 +108,61 @@ public:
 	 */
 	uint16_t reportingInterval = 5; // TODO: Must define units. Same as parameter sampling rates
 
+	/**
+	 * Adds a new sample to the statistics of every parameter that changed since the last call, using its current
+	 * value. Parameters that did not change are not visited at all.
+	 *
+	 * Statistics with a self-sampling interval are skipped, since they are sampled by \ref sampleDueStatistics(), so
+	 * that no parameter is sampled by both functions.
+	 *
+	 * @note A parameter that changed more than once between two calls only contributes its latest value.
+	 */
+	void updateChangedStatistics();
+
+	/**
+	 * Samples every parameter whose self-sampling interval has elapsed, and generates a TM[4,2] report if periodic
+	 * reporting is enabled and the reporting interval has elapsed. Parameters that are not due are not visited.
+	 *
+	 * The self-sampling intervals of the statistics and the \ref reportingInterval are in milliseconds. A statistic
+	 * with a sampling interval of 0 is never sampled by this function.
+	 *
+	 * @param currentTime The current system time, in milliseconds
+	 * @return The time until this function needs to be called again, in milliseconds, or the maximum value of
+	 * `uint32_t` if there is nothing to sample or report
+	 */
+	uint32_t sampleDueStatistics(uint32_t currentTime);
+
+	/**
+	 * Starts keeping rolling statistics of the most recent samples of a parameter, in addition to its cumulative
+	 * statistics. If they are already kept, they are cleared.
+	 *
+	 * @param maxAge The max age of the samples in the window in milliseconds, as measured by \ref TimeGetter, or 0 to
+	 * only limit the number of samples
+	 * @return False if the parameter has no statistics definition
+	 */
+	bool enableWindowedStatistics(uint16_t parameterId, uint32_t maxAge);
+
+	/**
+	 * Stops keeping rolling statistics of a parameter
+	 */
+	void disableWindowedStatistics(uint16_t parameterId);
+
+	/**
+	 * Removes the samples of the rolling statistics of a parameter that have expired at the current time of
+	 * \ref TimeGetter, so that a parameter that is no longer sampled does not keep reporting its old samples.
+	 *
+	 * @return The rolling statistics of the parameter, or nothing if they are not enabled for it
+	 */
+	std::optional<std::reference_wrapper<const WindowedStatistic<>>> getWindowedStatistic(uint16_t parameterId);
+
 	/**
 	 * TC[4,1] report the parameter statistics, by calling parameterStatisticsReport()
 	 */
 	void reportParameterStatistics(Message& request);
 
 	/**
-	 * Constructs and stores a TM[4,2] packet containing the parameter statistics report.
+	 * Constructs and stores a TM[4,2] packet containing the parameter statistics report. If the statistics do not fit
+	 * in a single packet, they are split into consecutive packets with the same evaluation times.
 	 */
 	void parameterStatisticsReport();
 
@@ -108,7 +202,8 @@ public:
 	 */
 	void reportStatisticsDefinitions(Message& request);
 	/**
-	 * Constructs and stores a TM[4,9] packet containing the parameter statistics definitions report.
+	 * Constructs and stores a TM[4,9] packet containing the parameter statistics definitions report. If the
+	 * definitions do not fit in a single packet, they are split into consecutive packets.
 	 */
 	void statisticsDefinitionsReport();
 
@@ -17,15 +17,28 @@
  *
  * @author Konstantinos Petridis <petridkon@gmail.com>
  */
-class RealTimeForwardingControlService {
+class RealTimeForwardingControlService : public Service {
 public:
 	inline static const uint8_t ServiceType = 14;
 
 	enum MessageType : uint8_t {
 		AddReportTypesToAppProcessConfiguration = 1,
+		DeleteReportTypesFromAppProcessConfiguration = 2,
+		ReportAppProcessConfigurationContent = 3,
+		AppProcessConfigurationContentReport = 4,
+		AddStructuresToHousekeepingConfiguration = 5,
+		DeleteStructuresFromHousekeepingConfiguration = 6,
+		ReportHousekeepingConfigurationContent = 7,
+		HousekeepingConfigurationContentReport = 8,
+		AddEventDefinitionsToEventReportBlocking = 9,
+		DeleteEventDefinitionsFromEventReportBlocking = 10,
+		ReportEventReportBlockingContent = 11,
+		EventReportBlockingContentReport = 12,
 	};
 
-	RealTimeForwardingControlService() = default;
+	RealTimeForwardingControlService() {
+		serviceType = ServiceType;
+	}
 
 	/**
 	 * Contains the Application IDs, controlled by the Service.
@@ -38,6 +51,17 @@ public:
 	 */
 	ApplicationProcessConfiguration applicationProcessConfiguration;
 
+	/**
+	 * The housekeeping structures whose housekeeping parameter reports are forwarded, for each application process.
+	 * It only applies to the reports whose report type is in the \ref applicationProcessConfiguration.
+	 */
+	HousekeepingReportConfiguration housekeepingReportConfiguration;
+
+	/**
+	 * The event definitions whose event reports are not forwarded, for each application process
+	 */
+	EventReportBlockingConfiguration eventReportBlockingConfiguration;
+
 private:
 	/**
 	 * Adds all report types of the specified application process definition, to the application process configuration.
@@ -110,12 +134,118 @@ private:
 	 */
 	bool checkMessage(Message& request, uint8_t applicationID, uint8_t serviceType, uint8_t messageType);
 
+	/**
+	 * Adds the identifiers of a request to a housekeeping or event report blocking configuration. The request contains
+	 * the number of application processes (uint8), and for each one its ID (uint8), the number of identifiers (uint16)
+	 * and the identifiers. If an application process has no identifiers, all of them are added.
+	 *
+	 * @param invalidIdentifierError The error reported for each identifier that is out of range
+	 */
+	template <typename Identifier, uint16_t IdentifierCount>
+	void addIdentifiers(Message& request, ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration,
+	                    ErrorHandler::ExecutionStartErrorType invalidIdentifierError);
+
+	/**
+	 * Deletes the identifiers of a request from a housekeeping or event report blocking configuration. The request has
+	 * the same format as in \ref addIdentifiers(). If there are no application processes, the configuration is
+	 * emptied, and if an application process has no identifiers, all of its identifiers are deleted.
+	 */
+	template <typename Identifier, uint16_t IdentifierCount>
+	void deleteIdentifiers(Message& request, ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration);
+
+	/**
+	 * Generates the content reports of a housekeeping or event report blocking configuration, in the same format as
+	 * the requests of \ref addIdentifiers(). The application processes without identifiers are left out.
+	 *
+	 * The content is split across as many reports as needed to fit in \ref ECSSMaxMessageSize. The identifiers of an
+	 * application process that do not fit in a report continue in the next one, under the same application process.
+	 */
+	template <typename Identifier, uint16_t IdentifierCount>
+	void identifiersContentReport(MessageType messageType,
+	                              const ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration);
+
 public:
 	/**
 	 * TC[14,1] 'Add report types to the application process forward control configuration'.
 	 */
 	void addReportTypesToAppProcessConfiguration(Message& request);
 
+	/**
+	 * TC[14,2] 'Delete report types from the application process forward control configuration'. The request has the
+	 * same format as TC[14,1]. If it contains no application processes, the whole configuration is emptied. An
+	 * application process without service types, or a service type without report types, is deleted with all of its
+	 * definitions.
+	 */
+	void deleteReportTypesFromAppProcessConfiguration(Message& request);
+
+	/**
+	 * TC[14,3] 'Report the content of the application process forward control configuration'
+	 */
+	void reportAppProcessConfigurationContent(Message& request);
+
+	/**
+	 * TM[14,4] 'Application process forward control configuration content report', in the same format as TC[14,1]
+	 */
+	void appProcessConfigurationContentReport();
+
+	/**
+	 * TC[14,5] 'Add structure identifiers to the housekeeping parameter report forward control configuration'
+	 * @see addIdentifiers()
+	 */
+	void addStructuresToHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,6] 'Delete structure identifiers from the housekeeping parameter report forward control configuration'
+	 * @see deleteIdentifiers()
+	 */
+	void deleteStructuresFromHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,7] 'Report the content of the housekeeping parameter report forward control configuration'
+	 */
+	void reportHousekeepingConfigurationContent(Message& request);
+
+	/**
+	 * TM[14,8] 'Housekeeping parameter report forward control configuration content report'
+	 * @see identifiersContentReport()
+	 */
+	void housekeepingConfigurationContentReport();
+
+	/**
+	 * TC[14,9] 'Add event definition identifiers to the event report blocking forward control configuration'
+	 * @see addIdentifiers()
+	 */
+	void addEventDefinitionsToEventReportBlocking(Message& request);
+
+	/**
+	 * TC[14,10] 'Delete event definition identifiers from the event report blocking forward control configuration'
+	 * @see deleteIdentifiers()
+	 */
+	void deleteEventDefinitionsFromEventReportBlocking(Message& request);
+
+	/**
+	 * TC[14,11] 'Report the content of the event report blocking forward control configuration'
+	 */
+	void reportEventReportBlockingContent(Message& request);
+
+	/**
+	 * TM[14,12] 'Event report blocking forward control configuration content report'
+	 * @see identifiersContentReport()
+	 */
+	void eventReportBlockingContentReport();
+
+	/**
+	 * Checks whether a message should be forwarded to the ground station. The TM reports of the controlled application
+	 * processes are only forwarded if their report type is in the application process configuration, while any
+	 * other message is always forwarded. Furthermore, housekeeping parameter reports are only forwarded if their
+	 * structure is in the \ref housekeepingReportConfiguration, and event reports are not forwarded if their event
+	 * definition is in the \ref eventReportBlockingConfiguration.
+	 *
+	 * @note This is called by Service::storeMessage() for every outgoing message, so it only takes a lookup in the
+	 * forwarding filters of the configurations.
+	 */
+	bool isReportForwarded(const Message& report) const;
+
 	/**
 	 * It is responsible to call the suitable function that executes a TC packet. The source of that packet
 	 * is the ground station.
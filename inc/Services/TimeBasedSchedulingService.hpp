@@ -2,10 +2,12 @@
 #define ECSS_SERVICES_TIMEBASEDSCHEDULINGSERVICE_HPP
 
 #include "ErrorHandler.hpp"
+#include "Helpers/ActivityGroups.hpp"
+#include "Helpers/ActivitySchedule.hpp"
 #include "Helpers/CRCHelper.hpp"
+#include "Helpers/RequestArena.hpp"
 #include "MessageParser.hpp"
 #include "Service.hpp"
-#include "etl/list.h"
 
 // Include platform specific files
 #include "Helpers/TimeGetter.hpp"
@@ -14,14 +16,18 @@
  * @def SUB_SCHEDULES_ENABLED
  * @brief Indicates whether sub-schedules are supported
  *
- * @details Sub-schedules are currently not implemented so this has no effect
+ * @details If enabled, the TC[11,4] requests contain a sub-schedule ID, the TM[11,10] and TM[11,13] reports contain
+ * the sub-schedule ID of each activity, and the sub-schedule subservices are available.
  */
 /**
  * @def GROUPS_ENABLED
  * @brief Indicates whether scheduling groups are enabled
+ *
+ * @details If enabled, each activity of the TC[11,4] requests has a group ID, the TM[11,10] and TM[11,13] reports
+ * contain the group ID of each activity, and the group subservices are available.
  */
-#define GROUPS_ENABLED 0
-#define SUB_SCHEDULES_ENABLED 0
+#define GROUPS_ENABLED 1
+#define SUB_SCHEDULES_ENABLED 1
 
 /**
  * @brief Namespace to access private members during test
@@ -37,6 +43,10 @@ namespace unit_test {
  *
  * @details This service is taking care of the timed release of a received TC packet from the
  * ground.
+ *
+ * @note Every activity belongs to a sub-schedule and a group. A due activity of a disabled sub-schedule or group is
+ * deleted without being released. The groups are predefined, so they cannot be created, and deleting a group with
+ * TC[11,23] deletes its activities.
  * @todo Define whether the parsed absolute release time is saved in the scheduled activity as an
  * uint32_t or in the time format specified by the time management service.
  *
@@ -67,45 +77,159 @@ private:
 			return (sequenceCount != rightSide.sequenceCount) or (applicationID != rightSide.applicationID) or
 			       (sourceID != rightSide.sourceID);
 		}
+
+		bool operator==(const RequestID& rightSide) const {
+			return not(*this != rightSide);
+		}
+
+		/**
+		 * @return A hash of all the fields of the ID, for the index of the schedule
+		 */
+		uint32_t hash() const {
+			uint32_t value = (static_cast<uint32_t>(applicationID) << 16U) ^ sequenceCount ^
+			                 (static_cast<uint32_t>(sourceID) << 8U);
+			// Mix the bits, so that consecutive sequence counts do not fill consecutive positions
+			value ^= value >> 16U;
+			value *= 0x45d9f3bU;
+			value ^= value >> 16U;
+			return value;
+		}
 	};
 
 	/**
 	 * @brief Instances of activities to run in the schedule
 	 *
 	 * @details All scheduled activities must contain the request they exist for, their release
-	 * time and the corresponding request identifier.
-	 *
-	 * @todo If we decide to use sub-schedules, the ID of that has to be defined
-	 * @todo If groups are used, then the group ID has to be defined here
+	 * time and the corresponding request identifier. The request itself is stored in \ref requests.
 	 */
 	struct ScheduledActivity {
-		Message request;                         ///< Hold the received command request
+		uint16_t requestHandle = 0;              ///< The handle of the command request in \ref requests
 		RequestID requestID;                     ///< Request ID, characteristic of the definition
-		Time::CustomCUC_t requestReleaseTime{0}; ///< Keep the command release time
+		Time::CustomCUC_t requestReleaseTime{0}; ///< The release time, without \ref scheduleTimeShift
+		uint8_t subScheduleID = 0;               ///< The sub-schedule that contains the activity
+		uint8_t groupID = 0;                     ///< The group that contains the activity
 	};
 
 	/**
 	 * @brief Hold the scheduled activities
 	 *
-	 * @details The scheduled activities in this list are ordered by their release time, as the
-	 * standard requests.
+	 * @details The scheduled activities are indexed by their release time, as the standard requests, and by their
+	 * request ID, so that neither the execution nor the requests that refer to activities by ID need a search.
 	 */
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> scheduledActivities;
+	ActivitySchedule<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> scheduledActivities;
 
 	/**
-	 * @brief Sort the activities by their release time
+	 * @brief The time shift of the whole schedule, in seconds
 	 *
-	 * @details The ECSS standard requires that the activities are sorted in the TM message
-	 * response. Also it is better to have the activities sorted.
-	 */
-	inline void
-	sortActivitiesReleaseTime(etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& schedActivities) {
-		schedActivities.sort([](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-			// cppcheck-suppress
-			return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-		});
+	 * @details A time shift of all activities only changes this offset, instead of every release time. Adding the
+	 * same offset to all activities does not change their order, so the index of the schedule stays valid. The
+	 * offset is added whenever a release time is read, and subtracted when a release time is stored.
+	 */
+	Time::RelativeTime scheduleTimeShift = 0;
+
+	/**
+	 * @brief Hold the TC packets of the scheduled activities
+	 *
+	 * @details Each packet takes only as many bytes as its length, so the schedule can hold many small TCs or a few
+	 * large ones, instead of reserving a full message for each activity.
+	 */
+	RequestArena<ECSSTimeSchedRequestArenaSize, ECSSMaxNumberOfTimeSchedActivities> requests;
+
+	/**
+	 * @brief The members and the status of each group, indexed by the positions of the activities in the schedule
+	 */
+	ActivityGroups<ECSSMaxNumberOfTimeSchedActivities, ECSSMaxTimeSchedGroups> groups;
+
+	/**
+	 * @brief The status of each sub-schedule
+	 */
+	etl::bitset<ECSSMaxTimeSchedSubSchedules> enabledSubSchedules;
+
+	/**
+	 * @brief Delete an activity from the schedule and from its group
+	 */
+	void deleteActivity(const ScheduledActivity& activity);
+
+	/**
+	 * @brief The release time of an activity, including \ref scheduleTimeShift
+	 */
+	Time::CustomCUC_t releaseTimeOf(const ScheduledActivity& activity) const {
+		return activity.requestReleaseTime + scheduleTimeShift;
 	}
 
+	/**
+	 * @brief Rebuild the TC packet of an activity from \ref requests
+	 */
+	Message getRequest(const ScheduledActivity& activity) const;
+
+	/**
+	 * @brief Append the TC packet of an activity to a report, as an octet string
+	 */
+	void appendRequest(Message& report, const ScheduledActivity& activity) const;
+
+	/**
+	 * @brief Append the details of an activity to a TM[11,10] report, which starts with the number of its activities
+	 * @details If the details do not fit in \p report, it is sent, and a new report is started in its place.
+	 * @param count The number of activities in \p report, updated by this function
+	 */
+	void appendActivityDetails(Message& report, uint16_t& count, const ScheduledActivity& activity);
+
+	/**
+	 * @brief Write the number of activities of a TM[11,10] report to its first field, and send it
+	 */
+	void storeDetailReport(Message& report, uint16_t count);
+
+	/**
+	 * @brief Enable or disable the sub-schedules of a TC[11,20] or TC[11,21] request
+	 */
+	void setSubScheduleStatus(Message& request, bool enabled);
+
+	/**
+	 * @brief Enable or disable the groups of a TC[11,24] or TC[11,25] request
+	 */
+	void setGroupStatus(Message& request, bool enabled);
+
+	/**
+	 * @brief Read the request IDs of a request and find the matching activities
+	 *
+	 * @details The activities are sorted by their release time, as the ECSS standard requires in the TM message
+	 * responses. Only their positions in the schedule are sorted, not the activities themselves.
+	 * @param request A request that contains the number of request IDs, followed by the IDs
+	 * @param[out] matchedActivities The positions of the matched activities in the schedule
+	 * @throws ExecutionStartError If a requested activity is not found in the schedule, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void findActivitiesByID(Message& request,
+	                        etl::vector<uint16_t, ECSSMaxNumberOfTimeSchedActivities>& matchedActivities);
+
+	/**
+	 * @brief Read a request ID from a request
+	 */
+	static RequestID readRequestID(Message& request);
+
+public:
+	/**
+	 * @brief Counters of the released activities
+	 */
+	struct ReleaseStatistics {
+		uint32_t releasedActivities = 0;
+		/**
+		 * The activities of disabled sub-schedules or groups that were deleted without being released
+		 */
+		uint32_t skippedActivities = 0;
+		/**
+		 * The max delay between the release time of an activity and the time it was released, in ticks of 100 ms
+		 */
+		uint64_t maxReleaseLatency = 0;
+		/**
+		 * The sum of the delays of all released activities, in ticks of 100 ms
+		 */
+		uint64_t totalReleaseLatency = 0;
+	};
+
+private:
+	ReleaseStatistics releaseStatistics;
+
 	/**
 	 * @brief Define a friend in order to be able to access private members during testing
 	 *
@@ -135,6 +259,15 @@ public:
 		TimeBasedScheduledSummaryReport = 13,
 		TimeShiftALlScheduledActivities = 15,
 		DetailReportAllScheduledActivities = 16,
+		ReportStatusOfSubSchedules = 18,
+		SubScheduleStatusReport = 19,
+		EnableSubSchedules = 20,
+		DisableSubSchedules = 21,
+		DeleteGroups = 23,
+		EnableGroups = 24,
+		DisableGroups = 25,
+		ReportStatusOfGroups = 26,
+		GroupStatusReport = 27,
 	};
 
 	/**
@@ -144,11 +277,31 @@ public:
 	TimeBasedSchedulingService();
 
 	/**
-	 * This function executes the next activity and removes it from the list.
+	 * This function executes the next activity, if its release time has been reached, and removes it from the list.
 	 * @return the requestReleaseTime of next activity to be executed after this time
 	 */
 	Time::CustomCUC_t executeScheduledActivity(Time::CustomCUC_t currentTime);
 
+	/**
+	 * Executes every activity whose release time is at or before \p currentTime, and removes it from the schedule.
+	 * The activities are executed in order of release time, and activities with the same release time in the order
+	 * they were inserted. Each activity is removed before it is executed, so an executed TC may change the schedule.
+	 *
+	 * @param maxActivities The max number of activities to execute. The rest are executed by the next call.
+	 * @return The time at which this function needs to be called again. This is at or before \p currentTime if some
+	 * due activities were left for the next call, or the max time if the schedule is empty.
+	 */
+	Time::CustomCUC_t releaseDueActivities(Time::CustomCUC_t currentTime,
+	                                       uint16_t maxActivities = ECSSMaxNumberOfTimeSchedActivities);
+
+	const ReleaseStatistics& getReleaseStatistics() const {
+		return releaseStatistics;
+	}
+
+	void resetReleaseStatistics() {
+		releaseStatistics = ReleaseStatistics();
+	}
+
 	/**
 	 * @brief TC[11,1] enable the time-based schedule execution function
 	 *
@@ -181,13 +334,17 @@ public:
 	 * by ascending order of their release time. This done to avoid confusion during the
 	 * execution of the schedule and also to make things easier whenever a release time sorted
 	 * report is requested by he corresponding service.
+	 *
+	 * Each TC packet is an octet string, i.e. its length as an uint16 followed by its PUS header and its data, so TCs
+	 * of any length fit, as long as there is space left in \ref requests.
 	 * @param request Provide the received message as a parameter
 	 * @todo Definition of the time format is required
 	 * @throws ExecutionStartError If there is request to be inserted and the maximum
 	 * number of activities in the current schedule has been reached, then an @ref
 	 * ErrorHandler::ExecutionStartErrorType is being issued.  Also if the release time of the
 	 * request is less than a set time margin, defined in @ref ECSS_TIME_MARGIN_FOR_ACTIVATION,
-	 * from the current time a @ref ErrorHandler::ExecutionStartErrorType is also issued.
+	 * from the current time a @ref ErrorHandler::ExecutionStartErrorType is also issued. The same
+	 * error is issued if the TC packet is malformed or does not fit in the remaining space.
 	 */
 	void insertActivities(Message& request);
 
@@ -196,6 +353,7 @@ public:
 	 *
 	 * @details All scheduled activities are shifted per user request. The relative time offset
 	 * received and tested against the current time.
+	 * The shift is applied in constant time, regardless of the number of activities.
 	 * @param request Provide the received message as a parameter
 	 * @todo Definition of the time format is required for the relative time format
 	 * @throws ExecutionStartError If the release time of the request is less than a
@@ -208,7 +366,8 @@ public:
 	 * @brief TC[11,16] detail-report all activities
 	 *
 	 * @details Send a detailed report about the status of all the activities
-	 * on the current schedule. Generates a TM[11,10] response.
+	 * on the current schedule. Generates a TM[11,10] response, which is split across as many
+	 * reports as needed to fit in \ref ECSSMaxMessageSize.
 	 * @param request Provide the received message as a parameter
 	 * @todo Replace the time parsing with the time parser
 	 */
@@ -218,8 +377,9 @@ public:
 	 * @brief TC[11,9] detail-report activities identified by request identifier
 	 *
 	 * @details Send a detailed report about the status of the requested activities, based on the
-	 * provided request identifier. Generates a TM[11,10] response. The matched activities are
-	 * contained in the report, in an ascending order based on their release time.
+	 * provided request identifier. Generates a TM[11,10] response, split like the one of
+	 * detailReportAllActivities(). The matched activities are contained in the report, in an
+	 * ascending order based on their release time.
 	 * @param request Provide the received message as a parameter
 	 * @todo Replace time parsing with the time parser
 	 * @throws ExecutionStartError If a requested activity, identified by the provided
@@ -266,6 +426,76 @@ public:
 	 */
 	void timeShiftActivitiesByID(Message& request);
 
+#if SUB_SCHEDULES_ENABLED
+	/**
+	 * @brief TC[11,18] report the status of each sub-schedule
+	 *
+	 * @details Generates a TM[11,19] response, with the ID and the status of every sub-schedule.
+	 * @param request Provide the received message as a parameter
+	 */
+	void reportSubScheduleStatus(Message& request);
+
+	/**
+	 * @brief TC[11,20] enable sub-schedules
+	 *
+	 * @details If the request contains no sub-schedule IDs, all sub-schedules are enabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule ID is invalid, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void enableSubSchedules(Message& request);
+
+	/**
+	 * @brief TC[11,21] disable sub-schedules
+	 *
+	 * @details If the request contains no sub-schedule IDs, all sub-schedules are disabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule ID is invalid, an @ref
+	 * ErrorHandler::ExecutionStartErrorType is issued for that instruction.
+	 */
+	void disableSubSchedules(Message& request);
+#endif
+
+#if GROUPS_ENABLED
+	/**
+	 * @brief TC[11,23] delete time-based schedule groups
+	 *
+	 * @details The groups are predefined, so their activities are deleted, and the groups are enabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group ID is invalid, an @ref ErrorHandler::ExecutionStartErrorType is
+	 * issued for that instruction.
+	 */
+	void deleteGroups(Message& request);
+
+	/**
+	 * @brief TC[11,24] enable time-based schedule groups
+	 *
+	 * @details If the request contains no group IDs, all groups are enabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group ID is invalid, an @ref ErrorHandler::ExecutionStartErrorType is
+	 * issued for that instruction.
+	 */
+	void enableGroups(Message& request);
+
+	/**
+	 * @brief TC[11,25] disable time-based schedule groups
+	 *
+	 * @details If the request contains no group IDs, all groups are disabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group ID is invalid, an @ref ErrorHandler::ExecutionStartErrorType is
+	 * issued for that instruction.
+	 */
+	void disableGroups(Message& request);
+
+	/**
+	 * @brief TC[11,26] report the status of each time-based schedule group
+	 *
+	 * @details Generates a TM[11,27] response, with the ID, the status and the number of activities of every group.
+	 * @param request Provide the received message as a parameter
+	 */
+	void reportGroupStatus(Message& request);
+#endif
+
 	/**
 	 * It is responsible to call the suitable function that executes a telecommand packet. The source of that packet
 	 * is the ground station.
@@ -262,6 +262,62 @@ namespace Time {
 		return (year % 400) == 0;
 	}
 
+	/**
+	 * A date of the proleptic Gregorian calendar
+	 */
+	struct CivilDate {
+		uint16_t year;
+		uint8_t month; ///< From 1 to 12
+		uint8_t day;   ///< From 1 to 31
+	};
+
+	/**
+	 * Returns the number of days from 1 January 1970 to a date, in constant time, without iterating over the years and
+	 * the months in between. The result is negative for earlier dates.
+	 *
+	 * The year is counted from March, so that the leap day is the last day of the year, and the days before each
+	 * month follow a linear formula. Years are grouped in eras of 400 years, which all have 146097 days.
+	 *
+	 * @see http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+	 */
+	constexpr int32_t daysFromCivil(uint16_t year, uint8_t month, uint8_t day) {
+		const int32_t marchYear = static_cast<int32_t>(year) - ((month <= 2) ? 1 : 0);
+		const int32_t era = ((marchYear >= 0) ? marchYear : (marchYear - 399)) / 400;
+		// Ranges: yearOfEra in [0, 399], dayOfYear in [0, 365], dayOfEra in [0, 146096]
+		const uint32_t yearOfEra = marchYear - era * 400;
+		const uint32_t dayOfYear = (153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+		const uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+		return era * 146097 + static_cast<int32_t>(dayOfEra) - 719468;
+	}
+
+	/**
+	 * Returns the date that is a number of days after 1 January 1970, in constant time. This is the inverse of
+	 * @ref daysFromCivil.
+	 *
+	 * @see http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+	 */
+	constexpr CivilDate civilFromDays(int32_t days) {
+		days += 719468;
+		const int32_t era = ((days >= 0) ? days : (days - 146096)) / 146097;
+		// Ranges: dayOfEra in [0, 146096], yearOfEra in [0, 399], dayOfYear in [0, 365], monthIndex in [0, 11]
+		const uint32_t dayOfEra = days - era * 146097;
+		const uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+		const uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+		// The months are counted from March
+		const uint32_t monthIndex = (5 * dayOfYear + 2) / 153;
+		const uint8_t day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+		const uint8_t month = (monthIndex < 10) ? (monthIndex + 3) : (monthIndex - 9);
+		const int32_t year = static_cast<int32_t>(yearOfEra) + era * 400 + ((month <= 2) ? 1 : 0);
+		return {static_cast<uint16_t>(year), month, day};
+	}
+
+	/**
+	 * The number of days from 1 January 1970 to the system @ref Epoch
+	 */
+	inline constexpr int32_t EpochDaysFromUnix = daysFromCivil(Epoch.year, Epoch.month, Epoch.day);
+
+	static_assert(EpochDaysFromUnix * SecondsPerDay == EpochSecondsFromUnix);
+
 	struct CustomCUC_t {
 		uint64_t elapsed100msTicks = 0;
 
@@ -55,7 +55,38 @@ private:
 	 */
 	static constexpr bool areSecondsValid(TAICounter_t seconds);
 
+	/**
+	 * Writes the CUC header of this format to \p output
+	 */
+	static void writeCUCHeader(uint8_t* output);
+
+	/**
+	 * @return True if \p input starts with the CUC header of this format
+	 */
+	static bool hasCUCHeader(const uint8_t* input);
+
+	/**
+	 * Writes \p counter to \p output as a big-endian number of `secondsBytes + fractionalBytes` bytes. The number
+	 * of bytes is known at compile time, so the loop is unrolled into a fixed-width byte swap.
+	 */
+	static void writeCounter(TAICounter_t counter, uint8_t* output);
+
+	/**
+	 * Reads a big-endian number of `secondsBytes + fractionalBytes` bytes from \p input
+	 */
+	static TAICounter_t readCounter(const uint8_t* input);
+
 public:
+	/**
+	 * The number of bytes of the CUC header of this format
+	 */
+	static constexpr uint8_t CUCHeaderSize = (secondsBytes < 4 && fractionalBytes < 3) ? 1 : 2;
+
+	/**
+	 * The number of bytes of a CUC timestamp of this format, including its header, without any padding
+	 */
+	static constexpr uint8_t CUCTimestampSize = CUCHeaderSize + secondsBytes + fractionalBytes;
+
 	/**
 	 * Initialize the TimeStamp at @ref Time::Epoch
 	 */
@@ -124,6 +155,42 @@ public:
 	 */
 	etl::array<uint8_t, Time::CUCTimestampMaximumSize> toCUCtimestamp();
 
+	/**
+	 * Encodes many timestamps as CUC formatted bytes at once. The timestamps are packed one after the other, each one
+	 * taking exactly @ref CUCTimestampSize bytes, including its header.
+	 *
+	 * @param timestamps The timestamps to encode
+	 * @param count The number of timestamps
+	 * @param[out] output At least `count * CUCTimestampSize` bytes
+	 */
+	static void toCUCtimestamps(const TimeStamp* timestamps, uint16_t count, uint8_t* output);
+
+	/**
+	 * Encodes many custom CUC timestamps as CUC formatted bytes of this format at once
+	 *
+	 * @see toCUCtimestamps(const TimeStamp*, uint16_t, uint8_t*)
+	 */
+	static void toCUCtimestamps(const Time::CustomCUC_t* timestamps, uint16_t count, uint8_t* output);
+
+	/**
+	 * Decodes many CUC timestamps of this format at once, as written by @ref toCUCtimestamps. The header of each
+	 * timestamp is compared with the header of this format, instead of being parsed.
+	 *
+	 * @param input `count * CUCTimestampSize` bytes of packed timestamps
+	 * @param count The number of timestamps
+	 * @param[out] timestamps At least \p count timestamps
+	 * @return The number of decoded timestamps. This is less than \p count if a timestamp has a different header,
+	 * in which case an @ref ErrorHandler::InvalidTimeStampInput is reported.
+	 */
+	static uint16_t fromCUCtimestamps(const uint8_t* input, uint16_t count, TimeStamp* timestamps);
+
+	/**
+	 * Decodes many CUC timestamps of this format at once, as custom CUC timestamps
+	 *
+	 * @see fromCUCtimestamps(const uint8_t*, uint16_t, TimeStamp*)
+	 */
+	static uint16_t fromCUCtimestamps(const uint8_t* input, uint16_t count, Time::CustomCUC_t* timestamps);
+
 	/**
 	 * Get the representation as a UTC timestamp
 	 *
@@ -64,17 +64,8 @@ TimeStamp<secondsCounter, fractionalBytes>::TimeStamp(etl::array<uint8_t, Time::
 
 template <uint8_t seconds_counter_bytes, uint8_t fractional_counter_bytes>
 TimeStamp<seconds_counter_bytes, fractional_counter_bytes>::TimeStamp(const UTCTimestamp& timestamp) {
-	TAICounter_t seconds = 0;
-	for (int year = Time::Epoch.year; year < timestamp.year; ++year) {
-		seconds += (Time::isLeapYear(year) ? 366 : 365) * Time::SecondsPerDay;
-	}
-	for (int month = Time::Epoch.month; month < timestamp.month; ++month) {
-		seconds += Time::DaysOfMonth[month - 1] * Time::SecondsPerDay;
-		if ((month == 2U) && Time::isLeapYear(timestamp.year)) {
-			seconds += Time::SecondsPerDay;
-		}
-	}
-	seconds += (timestamp.day - Time::Epoch.day) * Time::SecondsPerDay;
+	const int32_t days = Time::daysFromCivil(timestamp.year, timestamp.month, timestamp.day) - Time::EpochDaysFromUnix;
+	TAICounter_t seconds = static_cast<TAICounter_t>(days) * Time::SecondsPerDay;
 	seconds += timestamp.hour * Time::SecondsPerHour;
 	seconds += timestamp.minute * Time::SecondsPerMinute;
 	seconds += timestamp.second;
@@ -119,61 +110,112 @@ template <uint8_t secondsBytes, uint8_t fractionalBytes>
 etl::array<uint8_t, Time::CUCTimestampMaximumSize> TimeStamp<secondsBytes, fractionalBytes>::toCUCtimestamp() {
 	etl::array<uint8_t, Time::CUCTimestampMaximumSize> returnArray = {0};
 
-	static constexpr uint8_t headerBytes = (secondsBytes < 4 && fractionalBytes < 3) ? 1 : 2;
+	writeCUCHeader(returnArray.data());
+	writeCounter(taiCounter, returnArray.data() + CUCHeaderSize);
+
+	return returnArray;
+}
 
-	if (headerBytes == 1) {
-		returnArray[0] = static_cast<uint8_t>(CUCHeader);
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+void TimeStamp<secondsBytes, fractionalBytes>::writeCUCHeader(uint8_t* output) {
+	if constexpr (CUCHeaderSize == 1) {
+		output[0] = static_cast<uint8_t>(CUCHeader);
 	} else {
-		returnArray[1] = static_cast<uint8_t>(CUCHeader);
-		returnArray[0] = static_cast<uint8_t>(CUCHeader >> 8);
+		output[0] = static_cast<uint8_t>(CUCHeader >> 8);
+		output[1] = static_cast<uint8_t>(CUCHeader);
 	}
+}
 
-	for (auto byte = 0; byte < secondsBytes + fractionalBytes; byte++) {
-		uint8_t taiCounterIndex = 8 * (secondsBytes + fractionalBytes - byte - 1);
-		returnArray[headerBytes + byte] = taiCounter >> taiCounterIndex;
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+bool TimeStamp<secondsBytes, fractionalBytes>::hasCUCHeader(const uint8_t* input) {
+	if constexpr (CUCHeaderSize == 1) {
+		return input[0] == static_cast<uint8_t>(CUCHeader);
+	} else {
+		return (input[0] == static_cast<uint8_t>(CUCHeader >> 8)) && (input[1] == static_cast<uint8_t>(CUCHeader));
 	}
+}
 
-	return returnArray;
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+void TimeStamp<secondsBytes, fractionalBytes>::writeCounter(TAICounter_t counter, uint8_t* output) {
+	constexpr uint8_t counterBytes = secondsBytes + fractionalBytes;
+	for (uint8_t byte = 0; byte < counterBytes; byte++) {
+		output[byte] = static_cast<uint8_t>(counter >> (8 * (counterBytes - byte - 1)));
+	}
 }
 
 template <uint8_t secondsBytes, uint8_t fractionalBytes>
-UTCTimestamp TimeStamp<secondsBytes, fractionalBytes>::toUTCtimestamp() {
-	using namespace Time;
+typename TimeStamp<secondsBytes, fractionalBytes>::TAICounter_t
+TimeStamp<secondsBytes, fractionalBytes>::readCounter(const uint8_t* input) {
+	constexpr uint8_t counterBytes = secondsBytes + fractionalBytes;
+	TAICounter_t counter = 0;
+	for (uint8_t byte = 0; byte < counterBytes; byte++) {
+		counter = (counter << 8) | input[byte];
+	}
+	return counter;
+}
 
-	uint32_t totalSeconds = asTAIseconds();
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+void TimeStamp<secondsBytes, fractionalBytes>::toCUCtimestamps(const TimeStamp* timestamps, uint16_t count,
+                                                               uint8_t* output) {
+	for (uint16_t i = 0; i < count; i++) {
+		writeCUCHeader(output);
+		writeCounter(timestamps[i].taiCounter, output + CUCHeaderSize);
+		output += CUCTimestampSize;
+	}
+}
 
-	uint16_t yearUTC = Epoch.year;
-	uint8_t monthUTC = Epoch.month;
-	uint8_t dayUTC = Epoch.day;
-	uint8_t hour = 0;
-	uint8_t minute = 0;
-	uint8_t second = 0;
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+void TimeStamp<secondsBytes, fractionalBytes>::toCUCtimestamps(const Time::CustomCUC_t* timestamps, uint16_t count,
+                                                               uint8_t* output) {
+	for (uint16_t i = 0; i < count; i++) {
+		writeCUCHeader(output);
+		writeCounter(TimeStamp(timestamps[i]).taiCounter, output + CUCHeaderSize);
+		output += CUCTimestampSize;
+	}
+}
 
-	// calculate years
-	while (totalSeconds >= (isLeapYear(yearUTC) ? 366 : 365) * SecondsPerDay) {
-		totalSeconds -= (isLeapYear(yearUTC) ? 366 : 365) * SecondsPerDay;
-		yearUTC++;
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+uint16_t TimeStamp<secondsBytes, fractionalBytes>::fromCUCtimestamps(const uint8_t* input, uint16_t count,
+                                                                     TimeStamp* timestamps) {
+	for (uint16_t i = 0; i < count; i++) {
+		if (not hasCUCHeader(input)) {
+			ErrorHandler::reportInternalError(ErrorHandler::InternalErrorType::InvalidTimeStampInput);
+			return i;
+		}
+		timestamps[i].taiCounter = readCounter(input + CUCHeaderSize);
+		input += CUCTimestampSize;
 	}
+	return count;
+}
 
-	// calculate months
-	int currentMonth = 0;
-	while (totalSeconds >= (DaysOfMonth[currentMonth] * SecondsPerDay)) {
-		monthUTC++;
-		totalSeconds -= (DaysOfMonth[currentMonth] * SecondsPerDay);
-		currentMonth++;
-		if ((currentMonth == 1U) && isLeapYear(yearUTC)) {
-			if (totalSeconds <= (28 * SecondsPerDay)) {
-				break;
-			}
-			monthUTC++;
-			totalSeconds -= 29 * SecondsPerDay;
-			currentMonth++;
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+uint16_t TimeStamp<secondsBytes, fractionalBytes>::fromCUCtimestamps(const uint8_t* input, uint16_t count,
+                                                                     Time::CustomCUC_t* timestamps) {
+	for (uint16_t i = 0; i < count; i++) {
+		if (not hasCUCHeader(input)) {
+			ErrorHandler::reportInternalError(ErrorHandler::InternalErrorType::InvalidTimeStampInput);
+			return i;
 		}
+		TimeStamp timestamp;
+		timestamp.taiCounter = readCounter(input + CUCHeaderSize);
+		timestamps[i] = timestamp.asCustomCUCTimestamp();
+		input += CUCTimestampSize;
 	}
+	return count;
+}
+
+template <uint8_t secondsBytes, uint8_t fractionalBytes>
+UTCTimestamp TimeStamp<secondsBytes, fractionalBytes>::toUTCtimestamp() {
+	using namespace Time;
 
-	dayUTC = totalSeconds / SecondsPerDay;
-	totalSeconds -= dayUTC * SecondsPerDay;
-	dayUTC++; // add 1 day because we start count from 1 January (and not 0 January!)
+	uint64_t totalSeconds = asTAIseconds();
+
+	const CivilDate date = civilFromDays(EpochDaysFromUnix + static_cast<int32_t>(totalSeconds / SecondsPerDay));
+	totalSeconds %= SecondsPerDay;
+
+	uint8_t hour = 0;
+	uint8_t minute = 0;
+	uint8_t second = 0;
 
 	hour = totalSeconds / SecondsPerHour;
 	totalSeconds -= hour * SecondsPerHour;
@@ -183,5 +225,5 @@ UTCTimestamp TimeStamp<secondsBytes, fractionalBytes>::toUTCtimestamp() {
 
 	second = totalSeconds;
 
-	return {yearUTC, monthUTC, dayUTC, hour, minute, second};
+	return {date.year, date.month, date.day, hour, minute, second};
 }
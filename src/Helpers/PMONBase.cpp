@@ -1,9 +1,54 @@
 #include "Helpers/PMONBase.hpp"
-#include "ServicePool.hpp"
 
+PMONBase::PMONBase(uint16_t monitoredParameterId, uint16_t repetitionNumber, CheckType checkType)
+    : monitoredParameterId(monitoredParameterId), checkType(checkType), repetitionNumber(repetitionNumber) {}
 
-PMONBase::PMONBase(uint16_t monitoredParameterId, uint16_t repetitionNumber)
-    : monitoredParameter(monitoredParameter), monitoredParameterId(monitoredParameterId),
-      repetitionNumber(repetitionNumber) {
-	monitoredParameter = Services.parameterManagement.getParameter(monitoredParameterId)->get();
-}
\ No newline at end of file
+bool PMONBase::applyCheckResult(CheckingStatus result) {
+	if (result == checkingStatus) {
+		pendingCheckingStatus = result;
+		repetitionCounter = 0;
+		return false;
+	}
+
+	if (result != pendingCheckingStatus) {
+		pendingCheckingStatus = result;
+		repetitionCounter = 0;
+	}
+	repetitionCounter++;
+	if (repetitionCounter < repetitionNumber) {
+		return false;
+	}
+
+	checkTransitionList = {checkingStatus, result};
+	checkingStatus = result;
+	repetitionCounter = 0;
+	return true;
+}
+
+void PMONBase::restartChecks() {
+	pendingCheckingStatus = checkingStatus;
+	repetitionCounter = 0;
+	if (checkType == DeltaCheck) {
+		static_cast<PMONDeltaCheck*>(this)->resetDeltas();
+	}
+}
+
+std::optional<double> PMONDeltaCheck::addSample(double value) {
+	if (not hasPreviousValue) {
+		previousValue = value;
+		hasPreviousValue = true;
+		return {};
+	}
+
+	deltaSum += value - previousValue;
+	deltaCount++;
+	previousValue = value;
+	if (deltaCount < numberOfConsecutiveDeltaChecks) {
+		return {};
+	}
+
+	double averageDelta = deltaSum / deltaCount;
+	deltaSum = 0;
+	deltaCount = 0;
+	return averageDelta;
+}
@@ -0,0 +1,8 @@
+#include "Helpers/Parameter.hpp"
+#include "ServicePool.hpp"
+
+void ParameterBase::notifyChange() {
+#ifdef SERVICE_PARAMETER
+	Services.parameterManagement.notifyParameterChange(notificationIndex);
+#endif
+}
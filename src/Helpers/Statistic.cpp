@@ -1,4 +1,5 @@
 #include "Helpers/Statistic.hpp"
+#include <algorithm>
 #include <cmath>
 
 void Statistic::updateStatistics(double value) {
@@ -10,11 +11,122 @@ void Statistic::updateStatistics(double value) {
 		min = value;
 		timeOfMinValue = TimeGetter::getCurrentTimeCustomCUC();
 	}
-	if (sampleCounter + 1 > 0) {
-		mean = (mean * sampleCounter + value) / (sampleCounter + 1);
-	}
-	sumOfSquares += pow(value, 2);
+
 	sampleCounter++;
+	double deviation = value - mean;
+	mean += deviation / static_cast<double>(sampleCounter);
+	sumOfSquaredDeviations += deviation * (value - mean);
+}
+
+void Statistic::updateStatistics(etl::span<const double> values, etl::span<const Time::CustomCUC_t> timestamps) {
+	if (values.size() != timestamps.size()) {
+		ErrorHandler::reportInternalError(ErrorHandler::InvalidSampleBatch);
+		return;
+	}
+	if (values.empty()) {
+		return;
+	}
+
+	const size_t count = values.size();
+	const double* samples = values.data();
+
+	// Several independent accumulators, so that each iteration does not depend on the previous one and the loop can be
+	// vectorised without reordering floating-point operations
+	constexpr size_t Lanes = 4;
+	double laneSum[Lanes] = {};
+	double laneMax[Lanes];
+	double laneMin[Lanes];
+	std::fill(laneMax, laneMax + Lanes, -std::numeric_limits<double>::infinity());
+	std::fill(laneMin, laneMin + Lanes, std::numeric_limits<double>::infinity());
+
+	size_t i = 0;
+	for (; i + Lanes <= count; i += Lanes) {
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			double value = samples[i + lane];
+			laneSum[lane] += value;
+			laneMax[lane] = std::max(laneMax[lane], value);
+			laneMin[lane] = std::min(laneMin[lane], value);
+		}
+	}
+	for (; i < count; i++) {
+		laneSum[0] += samples[i];
+		laneMax[0] = std::max(laneMax[0], samples[i]);
+		laneMin[0] = std::min(laneMin[0], samples[i]);
+	}
+
+	double batchSum = 0;
+	double batchMax = laneMax[0];
+	double batchMin = laneMin[0];
+	for (size_t lane = 0; lane < Lanes; lane++) {
+		batchSum += laneSum[lane];
+		batchMax = std::max(batchMax, laneMax[lane]);
+		batchMin = std::min(batchMin, laneMin[lane]);
+	}
+
+	// The deviations are summed around the mean of the batch, which is known exactly at this point
+	const double batchMean = batchSum / count;
+	double laneDeviations[Lanes] = {};
+	for (i = 0; i + Lanes <= count; i += Lanes) {
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			double deviation = samples[i + lane] - batchMean;
+			laneDeviations[lane] += deviation * deviation;
+		}
+	}
+	for (; i < count; i++) {
+		double deviation = samples[i] - batchMean;
+		laneDeviations[0] += deviation * deviation;
+	}
+
+	Statistic batch;
+	batch.sampleCounter = count;
+	batch.mean = batchMean;
+	for (double laneDeviation: laneDeviations) {
+		batch.sumOfSquaredDeviations += laneDeviation;
+	}
+
+	// The position of an extreme value is only searched for when it replaces the current one
+	batch.max = batchMax;
+	if (batchMax > max) {
+		batch.timeOfMaxValue = timestamps[std::find(samples, samples + count, batchMax) - samples];
+	}
+	batch.min = batchMin;
+	if (batchMin < min) {
+		batch.timeOfMinValue = timestamps[std::find(samples, samples + count, batchMin) - samples];
+	}
+
+	merge(batch);
+}
+
+void Statistic::merge(const Statistic& other) {
+	if (other.sampleCounter == 0) {
+		return;
+	}
+
+	if (other.max > max) {
+		max = other.max;
+		timeOfMaxValue = other.timeOfMaxValue;
+	}
+	if (other.min < min) {
+		min = other.min;
+		timeOfMinValue = other.timeOfMinValue;
+	}
+
+	const auto count = static_cast<double>(sampleCounter);
+	const auto otherCount = static_cast<double>(other.sampleCounter);
+	const double totalCount = count + otherCount;
+	const double deviation = other.mean - mean;
+
+	mean += deviation * otherCount / totalCount;
+	sumOfSquaredDeviations += other.sumOfSquaredDeviations + deviation * deviation * count * otherCount / totalCount;
+	sampleCounter += other.sampleCounter;
+}
+
+double Statistic::standardDeviation() const {
+	if (sampleCounter == 0) {
+		return 0;
+	}
+
+	return std::sqrt(std::max(sumOfSquaredDeviations, 0.0) / static_cast<double>(sampleCounter));
 }
 
 void Statistic::appendStatisticsToMessage(Message& report) {
@@ -25,14 +137,7 @@ void Statistic::appendStatisticsToMessage(Message& report) {
 	report.appendFloat(static_cast<float>(mean));
 
 	if (SupportsStandardDeviation) {
-		double standardDeviation = 0;
-		if (sampleCounter == 0) {
-			standardDeviation = 0;
-		} else {
-			double meanOfSquares = sumOfSquares / sampleCounter;
-			standardDeviation = sqrt(abs(meanOfSquares - pow(mean, 2)));
-		}
-		report.appendFloat(static_cast<float>(standardDeviation));
+		report.appendFloat(static_cast<float>(standardDeviation()));
 	}
 }
 
@@ -46,12 +151,12 @@ void Statistic::resetStatistics() {
 	timeOfMaxValue.elapsed100msTicks = 0;
 	timeOfMinValue.elapsed100msTicks = 0;
 	mean = 0;
-	sumOfSquares = 0;
+	sumOfSquaredDeviations = 0;
 	sampleCounter = 0;
 }
 
 bool Statistic::statisticsAreInitialized() {
-	return (sampleCounter == 0 and mean == 0 and sumOfSquares == 0 and
+	return (sampleCounter == 0 and mean == 0 and sumOfSquaredDeviations == 0 and
 	        timeOfMaxValue.elapsed100msTicks == 0 and timeOfMinValue.elapsed100msTicks == 0 and
 	        max == -std::numeric_limits<double>::infinity() and min == std::numeric_limits<double>::infinity());
 }
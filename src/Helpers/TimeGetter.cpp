@@ -0,0 +1,13 @@
+#include "Helpers/TimeGetter.hpp"
+
+UTCTimestamp TimeGetter::getCurrentTimeUTC() {
+	using namespace Time;
+
+	uint64_t seconds = now() / NanosecondsPerSecond;
+	const CivilDate date = civilFromDays(EpochDaysFromUnix + static_cast<int32_t>(seconds / SecondsPerDay));
+	seconds %= SecondsPerDay;
+
+	return {date.year, date.month, date.day, static_cast<uint8_t>(seconds / SecondsPerHour),
+	        static_cast<uint8_t>((seconds % SecondsPerHour) / SecondsPerMinute),
+	        static_cast<uint8_t>(seconds % SecondsPerMinute)};
+}
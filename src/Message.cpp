@@ -79,6 +79,30 @@ void Message::appendWord(uint32_t value) {
 	dataSize += 4;
 }
 
+uint16_t Message::reserveBytes(uint16_t size) {
+	ASSERT_INTERNAL((dataSize + size) <= ECSSMaxMessageSize, ErrorHandler::MessageTooLarge);
+	ASSERT_INTERNAL(currentBit == 0, ErrorHandler::ByteBetweenBits);
+
+	uint16_t position = dataSize;
+	(void)memset(data + dataSize, 0, size);
+	dataSize += size;
+
+	return position;
+}
+
+void Message::patchUint8(uint16_t position, uint8_t value) {
+	ASSERT_INTERNAL((position + 1) <= dataSize, ErrorHandler::MessageTooLarge);
+
+	data[position] = value;
+}
+
+void Message::patchUint16(uint16_t position, uint16_t value) {
+	ASSERT_INTERNAL((position + 2) <= dataSize, ErrorHandler::MessageTooLarge);
+
+	data[position] = static_cast<uint8_t>((value >> 8) & 0xFF);
+	data[position + 1] = static_cast<uint8_t>(value & 0xFF);
+}
+
 uint16_t Message::readBits(uint8_t numBits) {
 	ASSERT_REQUEST(numBits <= 16, ErrorHandler::TooManyBitsRead);
 
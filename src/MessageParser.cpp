@@ -118,15 +118,19 @@ Message MessageParser::parse(uint8_t* data, uint32_t length) {
 	return message;
 }
 
-void MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Message& message) {
-	ErrorHandler::assertRequest(length >= 5, message, ErrorHandler::UnacceptableMessage);
+bool MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Message& message) {
+	if (not ErrorHandler::assertRequest(length >= 5, message, ErrorHandler::UnacceptableMessage)) {
+		return false;
+	}
 
 	// Individual fields of the TC header
 	uint8_t pusVersion = data[0] >> 4;
 	uint8_t serviceType = data[1];
 	uint8_t messageType = data[2];
 
-	ErrorHandler::assertRequest(pusVersion == 2U, message, ErrorHandler::UnacceptableMessage);
+	if (not ErrorHandler::assertRequest(pusVersion == 2U, message, ErrorHandler::UnacceptableMessage)) {
+		return false;
+	}
 
 	// Remove the length of the header
 	length -= 5;
@@ -136,6 +140,7 @@ void MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Mess
 	message.messageType = messageType;
 	std::copy(data + 5, data + 5 + length, message.data);
 	message.dataSize = length;
+	return true;
 }
 
 Message MessageParser::parseECSSTC(String<ECSSTCRequestStringSize> data) {
@@ -153,6 +158,14 @@ Message MessageParser::parseECSSTC(uint8_t* data) {
 	return message;
 }
 
+std::optional<Message> MessageParser::parseECSSTC(const uint8_t* data, uint16_t length) {
+	Message message(0, 0, Message::TC, 0);
+	if (not parseECSSTCHeader(data, length, message)) {
+		return {};
+	}
+	return message;
+}
+
 String<CCSDSMaxMessageSize> MessageParser::composeECSS(const Message& message, uint16_t size) {
 	uint8_t header[5];
 
@@ -2,8 +2,16 @@
 #include <iomanip>
 #include <Logger.hpp>
 #include "Service.hpp"
+#include "ServicePool.hpp"
 
 void Service::storeMessage(Message& message) {
+#ifdef SERVICE_REALTIMEFORWARDINGCONTROL
+	// Drop the reports that ST[14] does not forward to the ground station
+	if (not Services.realTimeForwarding.isReportForwarded(message)) {
+		return;
+	}
+#endif
+
 	// appends the remaining bits to complete a byte
 	message.finalize();
 
@@ -1,17 +1,24 @@
 #include "Helpers/TimeGetter.hpp"
 
-UTCTimestamp TimeGetter::getCurrentTimeUTC() {
-	time_t timeInSeconds = static_cast<time_t>(time(nullptr));
-	tm* UTCTimeStruct = gmtime(&timeInSeconds);
-	UTCTimestamp currentTime(UTCTimeStruct->tm_year, UTCTimeStruct->tm_mon,
-	                         UTCTimeStruct->tm_mday, UTCTimeStruct->tm_hour,
-	                         UTCTimeStruct->tm_min, UTCTimeStruct->tm_sec);
-	return currentTime;
-}
+namespace {
+	uint64_t toNanoseconds(const timespec& time) {
+		return static_cast<uint64_t>(time.tv_sec) * TimeGetter::NanosecondsPerSecond + time.tv_nsec;
+	}
+} // namespace
+
+uint64_t TimeGetter::getPlatformTime() {
+	// The monotonic clock starts at an arbitrary point, so it is aligned once with the system epoch. After that, the
+	// time is not affected by changes of the wall clock.
+	static const uint64_t monotonicClockOffset = [] {
+		timespec realTime{};
+		timespec monotonicTime{};
+		clock_gettime(CLOCK_REALTIME, &realTime);
+		clock_gettime(CLOCK_MONOTONIC, &monotonicTime);
+		return toNanoseconds(realTime) - Time::EpochSecondsFromUnix * NanosecondsPerSecond -
+		       toNanoseconds(monotonicTime);
+	}();
 
-Time::CustomCUC_t TimeGetter::getCurrentTimeCustomCUC() {
-	UTCTimestamp timeUTC = getCurrentTimeUTC();
-	TimeStamp<Time::CUCSecondsBytes, Time::CUCFractionalBytes> timeCUC(timeUTC);
-	Time::CustomCUC_t CUCtime = timeCUC.asCustomCUCTimestamp();
-	return CUCtime;
+	timespec monotonicTime{};
+	clock_gettime(CLOCK_MONOTONIC, &monotonicTime);
+	return monotonicClockOffset + toNanoseconds(monotonicTime);
 }
@@ -14,12 +14,16 @@
 #include "Services/TimeBasedSchedulingService.hpp"
 #include "Services/ParameterStatisticsService.hpp"
 #include "Helpers/Statistic.hpp"
+#include "Helpers/TimeGetter.hpp"
 #include "Message.hpp"
 #include "MessageParser.hpp"
 #include "ErrorHandler.hpp"
 #include "etl/String.hpp"
 #include "ServicePool.hpp"
 #include <ctime>
+#include <chrono>
+#include <thread>
+#include <algorithm>
 
 int main() {
 	LOG_NOTICE << "ECSS Services test application";
@@ -212,7 +216,9 @@ int main() {
 	eventActionDefinition.appendEnum16(0);
 	eventActionDefinition.appendEnum16(2);
 	eventActionDefinition.appendEnum16(1);
-	String<64> TCdata = "0123456789123456789123456789123456789123456789123456789123456789";
+	Message areYouAliveRequest(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 1);
+	String<CCSDSMaxMessageSize> composedRequest = MessageParser::composeECSS(areYouAliveRequest);
+	String<64> TCdata(reinterpret_cast<const uint8_t*>(composedRequest.data()), composedRequest.size());
 	eventActionDefinition.appendString(TCdata);
 	eventActionService.addEventActionDefinitions(eventActionDefinition);
 
@@ -221,7 +227,6 @@ int main() {
 	eventActionDefinition1.appendEnum16(0);
 	eventActionDefinition1.appendEnum16(2);
 	eventActionDefinition1.appendEnum16(1);
-	TCdata = "hi1";
 	eventActionDefinition1.appendString(TCdata);
 	std::cout << "After this message there should be a failed start of execution error \n";
 	eventActionService.addEventActionDefinitions(eventActionDefinition1);
@@ -231,7 +236,6 @@ int main() {
 	eventActionDefinition2.appendEnum16(0);
 	eventActionDefinition2.appendEnum16(4);
 	eventActionDefinition2.appendEnum16(2);
-	TCdata = "hi2";
 	eventActionDefinition2.appendString(TCdata);
 	eventActionService.addEventActionDefinitions(eventActionDefinition2);
 
@@ -240,13 +244,12 @@ int main() {
 	eventActionDefinition7.appendEnum16(0);
 	eventActionDefinition7.appendEnum16(4);
 	eventActionDefinition7.appendEnum16(4);
-	TCdata = "hi2";
 	eventActionDefinition7.appendString(TCdata);
 	eventActionService.addEventActionDefinitions(eventActionDefinition7);
 
 	std::cout << "Status should be 000:";
-	for (auto& element : eventActionService.eventActionDefinitionMap) {
-		std::cout << element.second.enabled;
+	for (auto& element : eventActionService.eventActionDefinitions) {
+		std::cout << element.enabled;
 	}
 
 	Message eventActionDefinition5(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction,
@@ -264,8 +267,8 @@ int main() {
 
 	eventActionService.enableEventActionDefinitions(eventActionDefinition5);
 	std::cout << "\nStatus should be 111:";
-	for (auto& element : eventActionService.eventActionDefinitionMap) {
-		std::cout << element.second.enabled;
+	for (auto& element : eventActionService.eventActionDefinitions) {
+		std::cout << element.enabled;
 	}
 
 	Message eventActionDefinition3(EventActionService::ServiceType, EventActionService::MessageType::DisableEventAction,
@@ -282,8 +285,8 @@ int main() {
 	eventActionDefinition3.appendUint16(4);
 	eventActionService.disableEventActionDefinitions(eventActionDefinition3);
 	std::cout << "Status should be 000:";
-	for (auto& element : eventActionService.eventActionDefinitionMap) {
-		std::cout << element.second.enabled;
+	for (auto& element : eventActionService.eventActionDefinitions) {
+		std::cout << element.enabled;
 	}
 
 	eventActionService.enableEventActionDefinitions(eventActionDefinition5);
@@ -308,6 +311,14 @@ int main() {
 	std::cout << "After this message there should NOT be a failed start of execution error \n";
 	eventActionService.deleteEventActionDefinitions(eventActionDefinition4);
 
+	// Raising an event only queues its actions. They are executed by the main loop of the platform.
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	std::cout << "Queued event-actions should be 2: " << eventActionService.getQueueDepth() << std::endl;
+	while (eventActionService.getQueueDepth() != 0) {
+		auto currentTimeMs = static_cast<uint32_t>(TimeGetter::now() / TimeGetter::NanosecondsPerMillisecond);
+		eventActionService.executePendingActions(currentTimeMs);
+	}
+
 	// ST13 test
 
 	LargePacketTransferService largePacketTransferService;
@@ -335,13 +346,16 @@ int main() {
 	// Insert activities in the schedule
 	receivedMsg = Message(TimeBasedSchedulingService::ServiceType,
 	                      TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	receivedMsg.appendUint8(0); // Sub-schedule ID
 	receivedMsg.appendUint16(2); // Total number of requests
 
+	receivedMsg.appendUint8(0); // Group ID
 	receivedMsg.appendUint32(currentTime + 1556435U);
-	receivedMsg.appendString(MessageParser::composeECSS(testMessage1));
+	receivedMsg.appendOctetString(MessageParser::composeECSS(testMessage1));
 
+	receivedMsg.appendUint8(1); // Group ID
 	receivedMsg.appendUint32(currentTime + 1957232U);
-	receivedMsg.appendString(MessageParser::composeECSS(testMessage2));
+	receivedMsg.appendOctetString(MessageParser::composeECSS(testMessage2));
 	timeBasedSchedulingService.insertActivities(receivedMsg);
 
 	// Time shift activities
@@ -361,6 +375,22 @@ int main() {
 	                      TimeBasedSchedulingService::MessageType::ActivitiesSummaryReportById, Message::TC, 1);
 	timeBasedSchedulingService.summaryReportActivitiesByID(receivedMsg);
 
+	// Periodic tasks, run for a few iterations here, while the main loop of a real platform runs forever
+	const uint32_t MaxLoopPeriodMs = 100;
+	ParameterStatisticsService& parameterStatisticsService = Services.parameterStatistics;
+	for (uint8_t iteration = 0; iteration < 5; iteration++) {
+		auto currentTimeMs = static_cast<uint32_t>(TimeGetter::now() / TimeGetter::NanosecondsPerMillisecond);
+		eventActionService.executePendingActions(currentTimeMs);
+		Services.eventReport.processThrottledEvents(currentTimeMs);
+
+		parameterStatisticsService.updateChangedStatistics();
+		uint32_t nextSamplingDelayMs = parameterStatisticsService.sampleDueStatistics(currentTimeMs);
+
+		Services.onBoardMonitoringService.checkParameters();
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(std::min(nextSamplingDelayMs, MaxLoopPeriodMs)));
+	}
+
 	LOG_NOTICE << "ECSS Services test complete";
 
 	std::cout << UTCTimestamp() << std::endl;
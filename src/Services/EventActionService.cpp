@@ -1,74 +1,111 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_EVENTACTION
 
+#include <algorithm>
 #include "Services/EventActionService.hpp"
 #include "Message.hpp"
 #include "MessageParser.hpp"
 
 
+Message EventActionService::ParsedRequest::toMessage() const {
+	Message message(serviceType, messageType, Message::TC, 0);
+	std::copy(data.begin(), data.begin() + dataSize, message.data);
+	message.dataSize = dataSize;
+	return message;
+}
+
+std::optional<uint16_t> EventActionService::findDefinitionIndex(uint16_t eventDefinitionID,
+                                                                uint16_t eventActionDefinitionID) const {
+	if (eventDefinitionID >= ECSSEventActionEventDefinitionCount) {
+		return {};
+	}
+	for (uint16_t index: definitionsOfEvent[eventDefinitionID]) {
+		if (eventActionDefinitions[index].eventActionDefinitionID == eventActionDefinitionID) {
+			return index;
+		}
+	}
+	return {};
+}
+
+void EventActionService::removeDefinition(uint16_t index) {
+	auto& indicesOfEvent = definitionsOfEvent[eventActionDefinitions[index].eventDefinitionID];
+	indicesOfEvent.erase(std::find(indicesOfEvent.begin(), indicesOfEvent.end(), index));
+
+	uint16_t lastIndex = eventActionDefinitions.size() - 1;
+	if (index != lastIndex) {
+		eventActionDefinitions[index] = eventActionDefinitions[lastIndex];
+		auto& indicesOfMovedEvent = definitionsOfEvent[eventActionDefinitions[index].eventDefinitionID];
+		*std::find(indicesOfMovedEvent.begin(), indicesOfMovedEvent.end(), lastIndex) = index;
+	}
+	eventActionDefinitions.pop_back();
+}
+
 void EventActionService::addEventActionDefinitions(Message& message) {
 	// TC[19,1]
 	message.assertTC(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction);
 	uint16_t applicationID = message.readEnum16();
 	uint16_t eventDefinitionID = message.readEnum16();
 	uint16_t eventActionDefinitionID = message.readEnum16();
-	bool canBeAdded = true;
-	if (eventActionDefinitionMap.find(eventDefinitionID) != eventActionDefinitionMap.end()) {
-		auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-		for (auto& element = range.first; element != range.second; ++element) {
-			if (element->second.eventActionDefinitionID == eventActionDefinitionID) {
-				canBeAdded = false;
-				ErrorHandler::reportError(message, ErrorHandler::EventActionDefinitionIDExistsError);
-			}
-		}
+
+	if (eventDefinitionID >= ECSSEventActionEventDefinitionCount) {
+		ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventDefinitionError);
+		return;
+	}
+	if (findDefinitionIndex(eventDefinitionID, eventActionDefinitionID)) {
+		ErrorHandler::reportError(message, ErrorHandler::EventActionDefinitionIDExistsError);
+		return;
 	}
 
-	if ((message.dataSize - 6) > ECSSTCRequestStringSize) {
-		canBeAdded = false;
+	uint16_t requestSize = message.dataSize - 6;
+	if (requestSize > ECSSTCRequestStringSize) {
 		ErrorHandler::reportInternalError(ErrorHandler::MessageTooLarge);
+		return;
 	}
-	if (canBeAdded) {
-		char data[ECSSTCRequestStringSize] = { 0 };
-		message.readString(data, message.dataSize - 6);
-		EventActionDefinition temp;
-		temp.enabled = false;
-		temp.applicationId = applicationID;
-		temp.eventDefinitionID = eventDefinitionID;
-		temp.eventActionDefinitionID = eventActionDefinitionID;
-		temp.request = String<ECSSTCRequestStringSize>(data);
-		if (eventActionDefinitionMap.size() == ECSSEventActionStructMapSize) {
-			ErrorHandler::reportError(message,ErrorHandler::EventActionDefinitionsMapIsFull);
-		} else {
-			eventActionDefinitionMap.insert(std::make_pair(eventDefinitionID, temp));
-		}
+
+	// Parse the TC only once, instead of every time the action is executed
+	auto request = MessageParser::parseECSSTC(message.data + message.readPosition, requestSize);
+	if (not request) {
+		return;
 	}
+
+	if (eventActionDefinitions.full() or definitionsOfEvent[eventDefinitionID].full()) {
+		ErrorHandler::reportError(message, ErrorHandler::EventActionDefinitionsMapIsFull);
+		return;
+	}
+
+	EventActionDefinition definition;
+	definition.enabled = false;
+	definition.applicationId = applicationID;
+	definition.eventDefinitionID = eventDefinitionID;
+	definition.eventActionDefinitionID = eventActionDefinitionID;
+	definition.request.serviceType = request->serviceType;
+	definition.request.messageType = request->messageType;
+	definition.request.dataSize = request->dataSize;
+	std::copy(request->data, request->data + request->dataSize, definition.request.data.begin());
+
+	definitionsOfEvent[eventDefinitionID].push_back(eventActionDefinitions.size());
+	eventActionDefinitions.push_back(definition);
 }
 
 void EventActionService::deleteEventActionDefinitions(Message& message) {
 	message.assertTC(EventActionService::ServiceType, EventActionService::MessageType::DeleteEventAction);
 	uint16_t numberOfEventActionDefinitions = message.readUint16();
-	bool definitionIDexists = false;
 	for (uint16_t i = 0; i < numberOfEventActionDefinitions; i++) {
 		message.skipBytes(2);
 		uint16_t eventDefinitionID = message.readEnum16();
 		uint16_t eventActionDefinitionID = message.readEnum16();
-		if (eventActionDefinitionMap.find(eventDefinitionID) != eventActionDefinitionMap.end()) {
-			auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-			for (auto& element = range.first; element != range.second; ++element) {
-				if (element->second.eventActionDefinitionID == eventActionDefinitionID) {
-					definitionIDexists = true;
-					if (element->second.enabled) {
-						ErrorHandler::reportError(message, ErrorHandler::EventActionDeleteEnabledDefinitionError);
-					} else {
-						eventActionDefinitionMap.erase(element);
-					}
-				}
-			}
-			if (not definitionIDexists) {
-				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
-			}
-		} else {
+		if (eventDefinitionID >= ECSSEventActionEventDefinitionCount or definitionsOfEvent[eventDefinitionID].empty()) {
 			ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventDefinitionError);
+			continue;
+		}
+
+		auto index = findDefinitionIndex(eventDefinitionID, eventActionDefinitionID);
+		if (not index) {
+			ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
+		} else if (eventActionDefinitions[*index].enabled) {
+			ErrorHandler::reportError(message, ErrorHandler::EventActionDeleteEnabledDefinitionError);
+		} else {
+			removeDefinition(*index);
 		}
 	}
 }
@@ -78,7 +115,11 @@ void EventActionService::deleteAllEventActionDefinitions(Message& message) {
 	message.assertTC(EventActionService::ServiceType, EventActionService::MessageType::DeleteAllEventAction);
 
 	setEventActionFunctionStatus(false);
-	eventActionDefinitionMap.clear();
+	eventActionDefinitions.clear();
+	for (auto& indicesOfEvent: definitionsOfEvent) {
+		indicesOfEvent.clear();
+	}
+	actionQueue.clear();
 }
 
 void EventActionService::enableEventActionDefinitions(Message& message) {
@@ -90,26 +131,22 @@ void EventActionService::enableEventActionDefinitions(Message& message) {
 			message.skipBytes(2); // Skips reading the application ID
 			uint16_t eventDefinitionID = message.readEnum16();
 			uint16_t eventActionDefinitionID = message.readEnum16();
-			if (eventActionDefinitionMap.find(eventDefinitionID) != eventActionDefinitionMap.end()) {
-				bool definitionIDexists = false;
-				auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-				for (auto& element = range.first; element != range.second; ++element) {
-					if (element->second.eventActionDefinitionID == eventActionDefinitionID) {
-						element->second.enabled = true;
-						definitionIDexists = true;
-						break;
-					}
-				}
-				if (not definitionIDexists) {
-					ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
-				}
-			} else {
+			if (eventDefinitionID >= ECSSEventActionEventDefinitionCount or
+			    definitionsOfEvent[eventDefinitionID].empty()) {
 				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventDefinitionError);
+				continue;
 			}
+
+			EventActionDefinition* definition = findEventActionDefinition(eventDefinitionID, eventActionDefinitionID);
+			if (definition == nullptr) {
+				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
+				continue;
+			}
+			definition->enabled = true;
 		}
 	} else {
-		for (auto& element : eventActionDefinitionMap) {
-			element.second.enabled = true;
+		for (auto& definition : eventActionDefinitions) {
+			definition.enabled = true;
 		}
 	}
 }
@@ -123,25 +160,22 @@ void EventActionService::disableEventActionDefinitions(Message& message) {
 			message.skipBytes(2); // Skips reading applicationID
 			uint16_t eventDefinitionID = message.readEnum16();
 			uint16_t eventActionDefinitionID = message.readEnum16();
-			if (eventActionDefinitionMap.find(eventDefinitionID) != eventActionDefinitionMap.end()) {
-				bool definitionIDexists = false;
-				auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-				for (auto& element = range.first; element != range.second; ++element) {
-					if (element->second.eventActionDefinitionID == eventActionDefinitionID) {
-						element->second.enabled = false;
-						definitionIDexists = true;
-					}
-				}
-				if (not definitionIDexists) {
-					ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
-				}
-			} else {
+			if (eventDefinitionID >= ECSSEventActionEventDefinitionCount or
+			    definitionsOfEvent[eventDefinitionID].empty()) {
 				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventDefinitionError);
+				continue;
+			}
+
+			EventActionDefinition* definition = findEventActionDefinition(eventDefinitionID, eventActionDefinitionID);
+			if (definition == nullptr) {
+				ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionIDError);
+				continue;
 			}
+			definition->enabled = false;
 		}
 	} else {
-		for (auto& element : eventActionDefinitionMap) {
-			element.second.enabled = false;
+		for (auto& definition : eventActionDefinitions) {
+			definition.enabled = false;
 		}
 	}
 }
@@ -156,13 +190,16 @@ void EventActionService::requestEventActionDefinitionStatus(Message& message) {
 void EventActionService::eventActionStatusReport() {
 	// TM[19,7]
 	Message report = createTM(EventActionStatusReport);
-	uint16_t count = eventActionDefinitionMap.size();
+	uint16_t count = eventActionDefinitions.size();
 	report.appendUint16(count);
-	for (const auto& element : eventActionDefinitionMap) {
-		report.appendEnum16(element.second.applicationId);
-		report.appendEnum16(element.second.eventDefinitionID);
-		report.appendEnum16(element.second.eventActionDefinitionID);
-		report.appendBoolean(element.second.enabled);
+	for (const auto& indicesOfEvent : definitionsOfEvent) {
+		for (uint16_t index : indicesOfEvent) {
+			const EventActionDefinition& definition = eventActionDefinitions[index];
+			report.appendEnum16(definition.applicationId);
+			report.appendEnum16(definition.eventDefinitionID);
+			report.appendEnum16(definition.eventActionDefinitionID);
+			report.appendBoolean(definition.enabled);
+		}
 	}
 	storeMessage(report);
 }
@@ -182,17 +219,75 @@ void EventActionService::disableEventActionFunction(Message& message) {
 }
 
 // TODO: Should I use applicationID too?
-void EventActionService::executeAction(uint16_t eventID) {
-	// Custom function
-	if (eventActionFunctionStatus) {
-		auto range = eventActionDefinitionMap.equal_range(eventID);
-		for (auto& element = range.first; element != range.second; ++element) {
-			if (element->second.enabled) {
-				Message message = MessageParser::parseECSSTC(element->second.request);
-				MessageParser::execute(message);
-			}
+void EventActionService::queueActions(uint16_t eventID) {
+	if (not eventActionFunctionStatus or eventID >= ECSSEventActionEventDefinitionCount) {
+		return;
+	}
+
+	if (minimumEventInterval != 0) {
+		// The difference is signed, so that the comparison still works when the time counter wraps around
+		if (isEventRateLimited[eventID] and static_cast<int32_t>(currentTime - nextAllowedEventTime[eventID]) < 0) {
+			actionQueueStatistics.rateLimitedEvents++;
+			return;
+		}
+		isEventRateLimited.set(eventID);
+		nextAllowedEventTime[eventID] = currentTime + minimumEventInterval;
+	}
+
+	for (uint16_t index: definitionsOfEvent[eventID]) {
+		EventActionDefinition& definition = eventActionDefinitions[index];
+		if (not definition.enabled) {
+			continue;
+		}
+		if (definition.pending) {
+			actionQueueStatistics.coalescedActions++;
+			continue;
+		}
+		if (actionQueue.full()) {
+			actionQueueStatistics.droppedActions++;
+			continue;
+		}
+
+		definition.pending = true;
+		actionQueue.push_back({eventID, definition.eventActionDefinitionID, currentTime});
+		actionQueueStatistics.maxQueueDepth = std::max<uint16_t>(actionQueueStatistics.maxQueueDepth,
+		                                                         actionQueue.size());
+	}
+}
+
+uint16_t EventActionService::executePendingActions(uint32_t time, uint16_t maxActions) {
+	currentTime = time;
+
+	// Actions that are queued by the executed TCs are appended to the queue, and are left for the next call
+	uint16_t actionsToVisit = actionQueue.size();
+	uint16_t executedActions = 0;
+	for (uint16_t i = 0; i < actionsToVisit and executedActions < maxActions; i++) {
+		QueuedAction action = actionQueue.front();
+		actionQueue.pop_front();
+
+		// A definition that is not pending was deleted after the action was queued, and possibly added again
+		EventActionDefinition* definition =
+		    findEventActionDefinition(action.eventDefinitionID, action.eventActionDefinitionID);
+		if (definition == nullptr or not definition->pending) {
+			continue;
+		}
+		definition->pending = false;
+		if (not definition->enabled or not eventActionFunctionStatus) {
+			continue;
 		}
+
+		uint32_t latency = time - action.queueTime;
+		actionQueueStatistics.maxLatency = std::max(actionQueueStatistics.maxLatency, latency);
+		actionQueueStatistics.totalLatency += latency;
+		actionQueueStatistics.executedActions++;
+		executedActions++;
+
+		// The definition may be moved by the executed TC, so it is not accessed after this point
+		Message message = definition->request.toMessage();
+		MessageParser::execute(message);
 	}
+
+	return executedActions;
 }
 
 void EventActionService::execute(Message& message) {
@@ -1,9 +1,11 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_EVENTREPORT
 
+#include <algorithm>
 #include <Services/EventReportService.hpp>
 #include <Services/EventActionService.hpp>
 #include "Message.hpp"
+#include "ServicePool.hpp"
 
 /**
  * @todo: Add message type in TCs
@@ -11,65 +13,170 @@
  */
 void EventReportService::informativeEventReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
 	// TM[5,1]
-	if (stateOfEvents[static_cast<uint16_t>(eventID)]) {
-		Message report = createTM(EventReportService::MessageType::InformativeEventReport);
-		report.appendEnum16(eventID);
-		report.appendString(data);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-
-		storeMessage(report);
-	}
+	reportEvent(EventReportService::MessageType::InformativeEventReport, eventID, data);
 }
 
 void
 EventReportService::lowSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
 	lowSeverityEventCount++;
 	// TM[5,2]
-	if (stateOfEvents[static_cast<uint16_t>(eventID)]) {
-		lowSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::LowSeverityAnomalyReport);
-		report.appendEnum16(eventID);
-		report.appendString(data);
-		lastLowSeverityReportID = static_cast<uint16_t>(eventID);
-
-		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-	}
+	reportEvent(EventReportService::MessageType::LowSeverityAnomalyReport, eventID, data);
 }
 
 void
 EventReportService::mediumSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
 	mediumSeverityEventCount++;
 	// TM[5,3]
-	if (stateOfEvents[static_cast<uint16_t>(eventID)]) {
-		mediumSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::MediumSeverityAnomalyReport);
-		report.appendEnum16(eventID);
-		report.appendString(data);
-		lastMediumSeverityReportID = static_cast<uint16_t>(eventID);
-
-		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
-	}
+	reportEvent(EventReportService::MessageType::MediumSeverityAnomalyReport, eventID, data);
 }
 
 void
 EventReportService::highSeverityAnomalyReport(Event eventID, const String<ECSSEventDataAuxiliaryMaxSize>& data) {
 	highSeverityEventCount++;
 	// TM[5,4]
-	if (stateOfEvents[static_cast<uint16_t>(eventID)]) {
-		highSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::HighSeverityAnomalyReport);
-		report.appendEnum16(eventID);
-		report.appendString(data);
-		lastHighSeverityReportID = static_cast<uint16_t>(eventID);
+	reportEvent(EventReportService::MessageType::HighSeverityAnomalyReport, eventID, data);
+}
 
-		storeMessage(report);
-		EventActionService eventActionService;
-		eventActionService.executeAction(eventID);
+void EventReportService::countReport(MessageType messageType, uint16_t eventID) {
+	switch (messageType) {
+		case LowSeverityAnomalyReport:
+			lowSeverityReportCount++;
+			lastLowSeverityReportID = eventID;
+			break;
+		case MediumSeverityAnomalyReport:
+			mediumSeverityReportCount++;
+			lastMediumSeverityReportID = eventID;
+			break;
+		case HighSeverityAnomalyReport:
+			highSeverityReportCount++;
+			lastHighSeverityReportID = eventID;
+			break;
+		default:
+			break;
+	}
+}
+
+bool EventReportService::reportEvent(MessageType messageType, Event eventID,
+                                     const String<ECSSEventDataAuxiliaryMaxSize>& data) {
+	auto id = static_cast<uint16_t>(eventID);
+	if (id >= numberOfEvents or not stateOfEvents[id]) {
+		return false;
+	}
+
+#ifdef SERVICE_EVENTACTION
+	Services.eventAction.queueActions(eventID);
+#endif
+
+	EventThrottle* throttle = findEventThrottle(id);
+	if (throttle != nullptr) {
+		if (throttle->tokens == 0) {
+			throttle->totalSuppressedOccurrences++;
+			if (throttle->aggregate) {
+				if (throttle->suppressedOccurrences == 0) {
+					throttle->firstSuppressedTime = currentTime;
+				}
+				throttle->suppressedOccurrences++;
+				throttle->lastSuppressedTime = currentTime;
+				throttle->suppressedMessageType = messageType;
+			}
+			return false;
+		}
+		throttle->tokens--;
+	}
+
+	Message report = createTM(messageType);
+	report.appendEnum16(eventID);
+	report.appendString(data);
+	countReport(messageType, id);
+
+	storeMessage(report);
+	return true;
+}
+
+void EventReportService::suppressedEventsReport(EventThrottle& throttle) {
+	Message report = createTM(throttle.suppressedMessageType);
+	report.appendEnum16(SuppressedEventsSummary);
+	report.appendEnum16(throttle.eventID);
+	report.appendUint32(throttle.suppressedOccurrences);
+	report.appendUint32(throttle.firstSuppressedTime);
+	report.appendUint32(throttle.lastSuppressedTime);
+	countReport(static_cast<MessageType>(throttle.suppressedMessageType), SuppressedEventsSummary);
+
+	storeMessage(report);
+	throttle.suppressedOccurrences = 0;
+}
+
+const EventReportService::EventThrottle* EventReportService::getEventThrottle(uint16_t eventID) const {
+	auto throttle = std::lower_bound(eventThrottles.begin(), eventThrottles.end(), eventID,
+	                                 [](const EventThrottle& throttle, uint16_t id) { return throttle.eventID < id; });
+	if (throttle == eventThrottles.end() or throttle->eventID != eventID) {
+		return nullptr;
+	}
+	return &*throttle;
+}
+
+bool EventReportService::setEventThrottle(uint16_t eventID, uint16_t bucketSize, uint32_t tokenInterval,
+                                          bool aggregate) {
+	if (eventID >= numberOfEvents or bucketSize == 0 or tokenInterval == 0) {
+		return false;
+	}
+
+	EventThrottle* throttle = findEventThrottle(eventID);
+	if (throttle == nullptr) {
+		if (eventThrottles.full()) {
+			return false;
+		}
+		auto position = std::lower_bound(eventThrottles.begin(), eventThrottles.end(), eventID,
+		                                 [](const EventThrottle& throttle, uint16_t id) { return throttle.eventID < id; });
+		throttle = &*eventThrottles.insert(position, EventThrottle());
+		throttle->eventID = eventID;
+	}
+
+	throttle->bucketSize = bucketSize;
+	throttle->tokenInterval = tokenInterval;
+	throttle->tokens = bucketSize;
+	throttle->lastRefillTime = currentTime;
+	throttle->aggregate = aggregate;
+	return true;
+}
+
+void EventReportService::removeEventThrottle(uint16_t eventID) {
+	EventThrottle* throttle = findEventThrottle(eventID);
+	if (throttle == nullptr) {
+		return;
+	}
+	if (throttle->suppressedOccurrences != 0) {
+		suppressedEventsReport(*throttle);
+	}
+	eventThrottles.erase(eventThrottles.begin() + (throttle - eventThrottles.data()));
+}
+
+void EventReportService::refillTokens(EventThrottle& throttle, uint32_t time) {
+	if (throttle.tokens == throttle.bucketSize) {
+		throttle.lastRefillTime = time;
+		return;
+	}
+
+	uint32_t refilledTokens = (time - throttle.lastRefillTime) / throttle.tokenInterval;
+	if (refilledTokens >= static_cast<uint32_t>(throttle.bucketSize - throttle.tokens)) {
+		throttle.tokens = throttle.bucketSize;
+		throttle.lastRefillTime = time;
+	} else {
+		// Part of a token may have been refilled, so the refill time only moves by whole tokens
+		throttle.tokens += refilledTokens;
+		throttle.lastRefillTime += refilledTokens * throttle.tokenInterval;
+	}
+}
+
+void EventReportService::processThrottledEvents(uint32_t time) {
+	currentTime = time;
+
+	for (auto& throttle: eventThrottles) {
+		refillTokens(throttle, time);
+		if (throttle.suppressedOccurrences != 0 and throttle.tokens != 0) {
+			throttle.tokens--;
+			suppressedEventsReport(throttle);
+		}
 	}
 }
 
@@ -81,13 +188,12 @@ void EventReportService::enableReportGeneration(Message message) {
 	 * @todo: Report an error if length > numberOfEvents
 	 */
 	uint16_t length = message.readUint16();
-	Event eventID[length];
-	for (uint16_t i = 0; i < length; i++) {
-		eventID[i] = static_cast<Event>(message.readEnum16());
-	}
 	if (length <= numberOfEvents) {
 		for (uint16_t i = 0; i < length; i++) {
-			stateOfEvents[static_cast<uint16_t>(eventID[i])] = true;
+			uint16_t eventID = message.readEnum16();
+			if (eventID < numberOfEvents) {
+				stateOfEvents[eventID] = true;
+			}
 		}
 	}
 	disabledEventsCount = stateOfEvents.size() - stateOfEvents.count();
@@ -101,13 +207,12 @@ void EventReportService::disableReportGeneration(Message message) {
 	 * @todo: Report an error if length > numberOfEvents
 	 */
 	uint16_t length = message.readUint16();
-	Event eventID[length];
-	for (uint16_t i = 0; i < length; i++) {
-		eventID[i] = static_cast<Event>(message.readEnum16());
-	}
 	if (length <= numberOfEvents) {
 		for (uint16_t i = 0; i < length; i++) {
-			stateOfEvents[static_cast<uint16_t>(eventID[i])] = false;
+			uint16_t eventID = message.readEnum16();
+			if (eventID < numberOfEvents) {
+				stateOfEvents[eventID] = false;
+			}
 		}
 	}
 	disabledEventsCount = stateOfEvents.size() - stateOfEvents.count();
@@ -122,17 +227,23 @@ void EventReportService::requestListOfDisabledEvents(Message message) {
 
 void EventReportService::listOfDisabledEventsReport() {
 	// TM[5,8]
-	Message report = createTM(EventReportService::MessageType::DisabledListEventReport);
+	uint16_t remainingEvents = stateOfEvents.size() - stateOfEvents.count();
+	uint16_t nextEventID = 0;
+	do {
+		uint16_t reportedEvents = std::min(remainingEvents, MaxDisabledEventsPerReport);
 
-	uint16_t numberOfDisabledEvents = stateOfEvents.size() - stateOfEvents.count();
-	report.appendHalfword(numberOfDisabledEvents);
-	for (size_t i = 0; i < stateOfEvents.size(); i++) {
-		if (not stateOfEvents[i]) {
-			report.appendEnum16(i);
+		Message report = createTM(EventReportService::MessageType::DisabledListEventReport);
+		report.appendHalfword(reportedEvents);
+		for (uint16_t i = 0; i < reportedEvents; nextEventID++) {
+			if (not stateOfEvents[nextEventID]) {
+				report.appendEnum16(nextEventID);
+				i++;
+			}
 		}
-	}
+		storeMessage(report);
 
-	storeMessage(report);
+		remainingEvents -= reportedEvents;
+	} while (remainingEvents != 0);
 }
 
 void EventReportService::execute(Message& message) {
@@ -119,10 +119,26 @@ void HousekeepingService::housekeepingParametersReport(uint8_t structureId) {
 	Message housekeepingReport(ServiceType, MessageType::HousekeepingParametersReport, Message::TM, 1);
 
 	housekeepingReport.appendUint8(structureId);
-	for (auto id : housekeepingStructures.at(structureId).simplyCommutatedParameterIds) {
-		if (auto parameter = Services.parameterManagement.getParameter(id)) {
-			parameter->get().appendValueToMessage(housekeepingReport);
+	uint16_t valuesPosition = housekeepingReport.dataSize;
+
+	const auto& parameterIds = housekeepingStructures.at(structureId).simplyCommutatedParameterIds;
+	uint32_t lockShards = 0;
+	for (auto id : parameterIds) {
+		lockShards |= Services.parameterManagement.lockShardsOf(id);
+	}
+
+	// All parameters of a structure are sampled at the same instant
+	bool consistent = Services.parameterManagement.readConsistently(lockShards, [&]() {
+		housekeepingReport.dataSize = valuesPosition;
+
+		for (auto id : parameterIds) {
+			if (auto parameter = Services.parameterManagement.getParameter(id)) {
+				parameter->get().appendValueToMessage(housekeepingReport);
+			}
 		}
+	});
+	if (not consistent) {
+		ErrorHandler::reportInternalError(ErrorHandler::InconsistentParameterRead);
 	}
 	storeMessage(housekeepingReport);
 }
@@ -193,19 +209,11 @@ void HousekeepingService::modifyCollectionIntervalOfStructures(Message& request)
 void HousekeepingService::reportHousekeepingPeriodicProperties(Message& request) {
 	request.assertTC(ServiceType, MessageType::ReportHousekeepingPeriodicProperties);
 
-	uint8_t numOfValidIds = 0;
-	uint8_t numOfStructIds = request.readUint8();
-	for (uint8_t i = 0; i < numOfStructIds; i++) {
-		uint8_t structIdToReport = request.readUint8();
-		if (housekeepingStructures.find(structIdToReport) != housekeepingStructures.end()) {
-			numOfValidIds++;
-		}
-	}
 	Message periodicPropertiesReport(ServiceType, MessageType::HousekeepingPeriodicPropertiesReport, Message::TM, 1);
-	periodicPropertiesReport.appendUint8(numOfValidIds);
-	request.resetRead();
-	request.readUint8();
+	uint8_t numOfValidIds = 0;
+	uint16_t numOfValidIdsPosition = periodicPropertiesReport.reserveBytes(sizeof(numOfValidIds));
 
+	uint8_t numOfStructIds = request.readUint8();
 	for (uint8_t i = 0; i < numOfStructIds; i++) {
 		uint8_t structIdToReport = request.readUint8();
 		if (housekeepingStructures.find(structIdToReport) == housekeepingStructures.end()) {
@@ -213,7 +221,9 @@ void HousekeepingService::reportHousekeepingPeriodicProperties(Message& request)
 			continue;
 		}
 		appendPeriodicPropertiesToMessage(periodicPropertiesReport, structIdToReport);
+		numOfValidIds++;
 	}
+	periodicPropertiesReport.patchUint8(numOfValidIdsPosition, numOfValidIds);
 	storeMessage(periodicPropertiesReport);
 }
 
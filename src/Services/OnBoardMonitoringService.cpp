@@ -1,23 +1,48 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_ONBOARDMONITORING
+#include <algorithm>
 #include "Message.hpp"
+#include "ServicePool.hpp"
+#include "Helpers/TimeGetter.hpp"
 #include "Services/OnBoardMonitoringService.hpp"
 #include "etl/map.h"
 
+PMONBase* OnBoardMonitoringService::findPMONDefinition(uint16_t PMONId) {
+	if (PMONBase* definition = expectedValueCheckDefinitions.find(PMONId)) {
+		return definition;
+	}
+	if (PMONBase* definition = limitCheckDefinitions.find(PMONId)) {
+		return definition;
+	}
+	return deltaCheckDefinitions.find(PMONId);
+}
+
+bool OnBoardMonitoringService::addPMONDefinition(uint16_t PMONId, const PMONExpectedValueCheck& PMONDefinition) {
+	return findPMONDefinition(PMONId) == nullptr and expectedValueCheckDefinitions.insert(PMONId, PMONDefinition);
+}
+
+bool OnBoardMonitoringService::addPMONDefinition(uint16_t PMONId, const PMONLimitCheck& PMONDefinition) {
+	return findPMONDefinition(PMONId) == nullptr and limitCheckDefinitions.insert(PMONId, PMONDefinition);
+}
+
+bool OnBoardMonitoringService::addPMONDefinition(uint16_t PMONId, const PMONDeltaCheck& PMONDefinition) {
+	return findPMONDefinition(PMONId) == nullptr and deltaCheckDefinitions.insert(PMONId, PMONDefinition);
+}
+
 void OnBoardMonitoringService::enableParameterMonitoringDefinitions(Message& message) {
 	message.assertTC(ServiceType, EnableParameterMonitoringDefinitions);
 
 	uint16_t numberOfPMONDefinitions = message.readUint16();
 	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
 		uint16_t currentId = message.readEnum16();
-		auto definition = parameterMonitoringList.find(currentId);
-		if (definition == parameterMonitoringList.end()) {
+		PMONBase* definition = findPMONDefinition(currentId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().repetitionNumber = 0;
-		definition->second.get().monitoringEnabled = true;
+		definition->restartChecks();
+		definition->monitoringEnabled = true;
 	}
 }
 
@@ -27,17 +52,44 @@ void OnBoardMonitoringService::disableParameterMonitoringDefinitions(Message& me
 	uint16_t numberOfPMONDefinitions = message.readUint16();
 	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
 		uint16_t currentId = message.readEnum16();
-		auto definition = parameterMonitoringList.find(currentId);
-		if (definition == parameterMonitoringList.end()) {
+		PMONBase* definition = findPMONDefinition(currentId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().monitoringEnabled = false;
-		definition->second.get().checkingStatus = PMONBase::Unchecked;
+		definition->monitoringEnabled = false;
+		definition->checkingStatus = PMONBase::Unchecked;
+		definition->restartChecks();
+		removeFromOutOfLimits(*definition);
+	}
+}
+
+void OnBoardMonitoringService::restartAllChecks() {
+	for (uint16_t i = 0; i < expectedValueCheckDefinitions.size(); i++) {
+		expectedValueCheckDefinitions[i].restartChecks();
+	}
+	for (uint16_t i = 0; i < limitCheckDefinitions.size(); i++) {
+		limitCheckDefinitions[i].restartChecks();
+	}
+	for (uint16_t i = 0; i < deltaCheckDefinitions.size(); i++) {
+		deltaCheckDefinitions[i].restartChecks();
 	}
 }
 
+void OnBoardMonitoringService::enableParameterMonitoringFunction(Message& message) {
+	message.assertTC(ServiceType, EnableParameterMonitoringFunction);
+	if (not parameterMonitoringFunctionStatus) {
+		restartAllChecks();
+	}
+	parameterMonitoringFunctionStatus = true;
+}
+
+void OnBoardMonitoringService::disableParameterMonitoringFunction(Message& message) {
+	message.assertTC(ServiceType, DisableParameterMonitoringFunction);
+	parameterMonitoringFunctionStatus = false;
+}
+
 void OnBoardMonitoringService::changeMaximumTransitionReportingDelay(Message& message) {
 	message.assertTC(ServiceType, ChangeMaximumTransitionReportingDelay);
 	maximumTransitionReportingDelay = message.readUint16();
@@ -50,7 +102,374 @@ void OnBoardMonitoringService::deleteAllParameterMonitoringDefinitions(Message&
 		    message, ErrorHandler::ExecutionStartErrorType::InvalidRequestToDeleteAllParameterMonitoringDefinitions);
 		return;
 	}
-	parameterMonitoringList.clear();
+	expectedValueCheckDefinitions.clear();
+	limitCheckDefinitions.clear();
+	deltaCheckDefinitions.clear();
+	outOfLimits.clear();
+}
+
+void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& message) {
+	message.assertTC(ServiceType, AddParameterMonitoringDefinitions);
+
+	uint16_t numberOfPMONDefinitions = message.readUint16();
+	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
+		uint16_t PMONId = message.readEnum16();
+		uint16_t monitoredParameterId = message.readEnum16();
+		uint16_t repetitionNumber = message.readUint16();
+		auto checkType = static_cast<PMONBase::CheckType>(message.readEnum8());
+
+		// The fields of the check type are read before validating, so that the next definition can still be parsed
+		auto isAcceptable = [&]() {
+			if (findPMONDefinition(PMONId) != nullptr) {
+				ErrorHandler::reportError(message, ErrorHandler::AddAlreadyExistingParameter);
+				return false;
+			}
+			if (not Services.parameterManagement.getParameter(monitoredParameterId)) {
+				ErrorHandler::reportError(message, ErrorHandler::GetNonExistingParameter);
+				return false;
+			}
+			return true;
+		};
+
+		bool isAdded = true;
+		switch (checkType) {
+			case PMONBase::ExpectedValueCheck: {
+				uint64_t mask = message.readUint64();
+				uint64_t expectedValue = message.readUint64();
+				uint16_t unexpectedValueEvent = message.readEnum16();
+
+				if (not isAcceptable()) {
+					continue;
+				}
+				if (not Services.parameterManagement.getParameter(monitoredParameterId)->get().getValueAsUint64()) {
+					ErrorHandler::reportError(message, ErrorHandler::ExpectedValueCheckOfNonIntegerParameter);
+					continue;
+				}
+				isAdded = expectedValueCheckDefinitions.insert(
+				    PMONId, PMONExpectedValueCheck(monitoredParameterId, repetitionNumber, expectedValue, mask,
+				                                   unexpectedValueEvent));
+				break;
+			}
+			case PMONBase::LimitCheck: {
+				double lowLimit = message.readDouble();
+				uint16_t belowLowLimitEvent = message.readEnum16();
+				double highLimit = message.readDouble();
+				uint16_t aboveHighLimitEvent = message.readEnum16();
+
+				if (not isAcceptable()) {
+					continue;
+				}
+				if (highLimit <= lowLimit) {
+					ErrorHandler::reportError(message, ErrorHandler::HighLimitIsLowerThanLowLimit);
+					continue;
+				}
+				isAdded = limitCheckDefinitions.insert(PMONId, PMONLimitCheck(monitoredParameterId, repetitionNumber,
+				                                                              lowLimit, belowLowLimitEvent, highLimit,
+				                                                              aboveHighLimitEvent));
+				break;
+			}
+			case PMONBase::DeltaCheck: {
+				double lowDeltaThreshold = message.readDouble();
+				uint16_t belowLowThresholdEvent = message.readEnum16();
+				double highDeltaThreshold = message.readDouble();
+				uint16_t aboveHighThresholdEvent = message.readEnum16();
+				uint16_t numberOfConsecutiveDeltaChecks = message.readUint16();
+
+				if (not isAcceptable()) {
+					continue;
+				}
+				if (highDeltaThreshold <= lowDeltaThreshold) {
+					ErrorHandler::reportError(message, ErrorHandler::HighThresholdIsLowerThanLowThreshold);
+					continue;
+				}
+				isAdded = deltaCheckDefinitions.insert(
+				    PMONId, PMONDeltaCheck(monitoredParameterId, repetitionNumber, numberOfConsecutiveDeltaChecks,
+				                           lowDeltaThreshold, belowLowThresholdEvent, highDeltaThreshold,
+				                           aboveHighThresholdEvent));
+				break;
+			}
+			default:
+				ErrorHandler::reportError(message, ErrorHandler::InvalidParameterMonitoringCheckType);
+				return;
+		}
+
+		if (not isAdded) {
+			ErrorHandler::reportError(message, ErrorHandler::ParameterMonitoringListIsFull);
+		}
+	}
+}
+
+std::optional<double> OnBoardMonitoringService::readMonitoredParameter(const PMONBase& definition) {
+	auto parameter = Services.parameterManagement.getParameter(definition.monitoredParameterId);
+	if (not parameter) {
+		return {};
+	}
+	return parameter->get().getValueAsDouble();
+}
+
+std::optional<uint64_t> OnBoardMonitoringService::readMonitoredIntegerParameter(const PMONBase& definition) {
+	auto parameter = Services.parameterManagement.getParameter(definition.monitoredParameterId);
+	if (not parameter) {
+		return {};
+	}
+	return parameter->get().getValueAsUint64();
+}
+
+bool OnBoardMonitoringService::isCheckUnnecessary(const PMONBase& definition) const {
+	if (not definition.isSettled()) {
+		return false;
+	}
+
+	auto parameter = Services.parameterManagement.getParameter(definition.monitoredParameterId);
+	if (not parameter) {
+		return true;
+	}
+	uint16_t notificationIndex = parameter->get().notificationIndex;
+	return notificationIndex != ParameterBase::NoNotificationIndex and not changedParameters.contains(notificationIndex);
+}
+
+void OnBoardMonitoringService::updateOutOfLimits(PMONBase& definition, const CheckTransition& transition) {
+	if (not PMONBase::isOutOfLimits(transition.currentStatus)) {
+		removeFromOutOfLimits(definition);
+		return;
+	}
+
+	if (definition.outOfLimitsIndex == PMONBase::NotOutOfLimits) {
+		if (outOfLimits.full()) {
+			ErrorHandler::reportInternalError(ErrorHandler::MapFull);
+			return;
+		}
+		definition.outOfLimitsIndex = outOfLimits.size();
+		outOfLimits.push_back(transition);
+	} else {
+		outOfLimits[definition.outOfLimitsIndex] = transition;
+	}
+}
+
+void OnBoardMonitoringService::removeFromOutOfLimits(PMONBase& definition) {
+	if (definition.outOfLimitsIndex == PMONBase::NotOutOfLimits) {
+		return;
+	}
+
+	// The last entry takes the place of the removed one, so that removal is O(1)
+	uint16_t index = definition.outOfLimitsIndex;
+	definition.outOfLimitsIndex = PMONBase::NotOutOfLimits;
+	if (index != outOfLimits.size() - 1) {
+		outOfLimits[index] = outOfLimits.back();
+		findPMONDefinition(outOfLimits[index].PMONId)->outOfLimitsIndex = index;
+	}
+	outOfLimits.pop_back();
+}
+
+template <typename Definition>
+void OnBoardMonitoringService::processCheckResult(uint16_t PMONId, Definition& definition,
+                                                  PMONBase::CheckingStatus result) {
+	if (not definition.applyCheckResult(result)) {
+		return;
+	}
+
+	PMONBase::CheckingStatus previousStatus = definition.checkTransitionList[0];
+	if (pendingTransitions.empty()) {
+		cyclesSinceFirstPendingTransition = 0;
+	}
+	CheckTransition transition = {PMONId, definition.monitoredParameterId, definition.checkType,
+	                              definition.crossedLimitOf(previousStatus, result), previousStatus, result,
+	                              TimeGetter::getCurrentTimeCustomCUC()};
+	updateOutOfLimits(definition, transition);
+	pendingTransitions.push_back(transition);
+	if (pendingTransitions.full()) {
+		checkTransitionReport();
+	}
+
+	std::optional<uint16_t> event = definition.eventOf(result);
+	if (not event) {
+		return;
+	}
+	etl::array<uint8_t, 2 * sizeof(uint16_t)> eventData = {
+	    static_cast<uint8_t>(PMONId >> 8U), static_cast<uint8_t>(PMONId & 0xFFU),
+	    static_cast<uint8_t>(definition.monitoredParameterId >> 8U),
+	    static_cast<uint8_t>(definition.monitoredParameterId & 0xFFU)};
+	Services.eventReport.lowSeverityAnomalyReport(static_cast<EventReportService::Event>(*event),
+	                                              String<ECSSEventDataAuxiliaryMaxSize>(eventData.data(),
+	                                                                                    eventData.size()));
+}
+
+void OnBoardMonitoringService::checkExpectedValueDefinitions() {
+	etl::array<uint16_t, CheckBatchSize> indices;
+	etl::array<uint64_t, CheckBatchSize> values;
+	etl::array<uint64_t, CheckBatchSize> masks;
+	etl::array<uint64_t, CheckBatchSize> expectedValues;
+	etl::array<PMONBase::CheckingStatus, CheckBatchSize> results;
+
+	uint16_t index = 0;
+	while (index < expectedValueCheckDefinitions.size()) {
+		uint16_t batchSize = 0;
+		for (; index < expectedValueCheckDefinitions.size() and batchSize < CheckBatchSize; index++) {
+			PMONExpectedValueCheck& definition = expectedValueCheckDefinitions[index];
+			if (not definition.monitoringEnabled or isCheckUnnecessary(definition)) {
+				continue;
+			}
+			auto value = readMonitoredIntegerParameter(definition);
+			if (not value) {
+				processCheckResult(expectedValueCheckDefinitions.getPMONId(index), definition, PMONBase::Invalid);
+				continue;
+			}
+
+			indices[batchSize] = index;
+			values[batchSize] = *value;
+			masks[batchSize] = definition.mask;
+			expectedValues[batchSize] = definition.expectedValue;
+			batchSize++;
+		}
+
+		PMONExpectedValueCheck::evaluate(values.data(), masks.data(), expectedValues.data(), results.data(),
+		                                 batchSize);
+		for (uint16_t i = 0; i < batchSize; i++) {
+			PMONExpectedValueCheck& definition = expectedValueCheckDefinitions[indices[i]];
+			processCheckResult(expectedValueCheckDefinitions.getPMONId(indices[i]), definition, results[i]);
+		}
+	}
+}
+
+void OnBoardMonitoringService::checkLimitDefinitions() {
+	etl::array<uint16_t, CheckBatchSize> indices;
+	etl::array<double, CheckBatchSize> values;
+	etl::array<double, CheckBatchSize> lowLimits;
+	etl::array<double, CheckBatchSize> highLimits;
+	etl::array<PMONBase::CheckingStatus, CheckBatchSize> results;
+
+	uint16_t index = 0;
+	while (index < limitCheckDefinitions.size()) {
+		uint16_t batchSize = 0;
+		for (; index < limitCheckDefinitions.size() and batchSize < CheckBatchSize; index++) {
+			PMONLimitCheck& definition = limitCheckDefinitions[index];
+			if (not definition.monitoringEnabled or isCheckUnnecessary(definition)) {
+				continue;
+			}
+			auto value = readMonitoredParameter(definition);
+			if (not value) {
+				processCheckResult(limitCheckDefinitions.getPMONId(index), definition, PMONBase::Invalid);
+				continue;
+			}
+
+			indices[batchSize] = index;
+			values[batchSize] = *value;
+			lowLimits[batchSize] = definition.lowLimit;
+			highLimits[batchSize] = definition.highLimit;
+			batchSize++;
+		}
+
+		PMONLimitCheck::evaluate(values.data(), lowLimits.data(), highLimits.data(), results.data(), batchSize);
+		for (uint16_t i = 0; i < batchSize; i++) {
+			PMONLimitCheck& definition = limitCheckDefinitions[indices[i]];
+			processCheckResult(limitCheckDefinitions.getPMONId(indices[i]), definition, results[i]);
+		}
+	}
+}
+
+void OnBoardMonitoringService::checkDeltaDefinitions() {
+	etl::array<uint16_t, CheckBatchSize> indices;
+	etl::array<double, CheckBatchSize> deltas;
+	etl::array<double, CheckBatchSize> lowThresholds;
+	etl::array<double, CheckBatchSize> highThresholds;
+	etl::array<PMONBase::CheckingStatus, CheckBatchSize> results;
+
+	uint16_t index = 0;
+	while (index < deltaCheckDefinitions.size()) {
+		uint16_t batchSize = 0;
+		for (; index < deltaCheckDefinitions.size() and batchSize < CheckBatchSize; index++) {
+			PMONDeltaCheck& definition = deltaCheckDefinitions[index];
+			if (not definition.monitoringEnabled) {
+				continue;
+			}
+			auto value = readMonitoredParameter(definition);
+			if (not value) {
+				processCheckResult(deltaCheckDefinitions.getPMONId(index), definition, PMONBase::Invalid);
+				continue;
+			}
+			auto averageDelta = definition.addSample(*value);
+			if (not averageDelta) {
+				continue;
+			}
+
+			indices[batchSize] = index;
+			deltas[batchSize] = *averageDelta;
+			lowThresholds[batchSize] = definition.lowDeltaThreshold;
+			highThresholds[batchSize] = definition.highDeltaThreshold;
+			batchSize++;
+		}
+
+		PMONDeltaCheck::evaluate(deltas.data(), lowThresholds.data(), highThresholds.data(), results.data(),
+		                         batchSize);
+		for (uint16_t i = 0; i < batchSize; i++) {
+			PMONDeltaCheck& definition = deltaCheckDefinitions[indices[i]];
+			processCheckResult(deltaCheckDefinitions.getPMONId(indices[i]), definition, results[i]);
+		}
+	}
+}
+
+void OnBoardMonitoringService::checkParameters() {
+	if (not parameterMonitoringFunctionStatus) {
+		return;
+	}
+
+	changedParameters = Services.parameterManagement.takeChangedParameters(ParameterChangeNotifier::Monitoring);
+	checkExpectedValueDefinitions();
+	checkLimitDefinitions();
+	checkDeltaDefinitions();
+
+	if (pendingTransitions.empty()) {
+		return;
+	}
+	if (cyclesSinceFirstPendingTransition >= maximumTransitionReportingDelay) {
+		checkTransitionReport();
+	} else {
+		cyclesSinceFirstPendingTransition++;
+	}
+}
+
+void OnBoardMonitoringService::appendCheckTransition(Message& report, const CheckTransition& transition) {
+	report.appendEnum16(transition.PMONId);
+	report.appendEnum16(transition.monitoredParameterId);
+	report.appendEnum8(transition.checkType);
+	report.appendDouble(transition.crossedLimit);
+	report.appendEnum8(transition.previousStatus);
+	report.appendEnum8(transition.currentStatus);
+	report.appendCustomCUCTimeStamp(transition.transitionTime);
+}
+
+void OnBoardMonitoringService::checkTransitionReport() {
+	if (pendingTransitions.empty()) {
+		return;
+	}
+
+	Message report(ServiceType, MessageType::CheckTransitionReport, Message::TM, 1);
+	report.appendUint16(pendingTransitions.size());
+	for (const auto& transition: pendingTransitions) {
+		appendCheckTransition(report, transition);
+	}
+	storeMessage(report);
+
+	pendingTransitions.clear();
+	cyclesSinceFirstPendingTransition = 0;
+}
+
+void OnBoardMonitoringService::reportOutOfLimits(Message& message) {
+	message.assertTC(ServiceType, ReportOutOfLimits);
+
+	uint16_t nextIndex = 0;
+	do {
+		uint16_t reportedDefinitions = std::min<uint16_t>(outOfLimits.size() - nextIndex, MaxTransitionsPerReport);
+
+		Message report(ServiceType, MessageType::OutOfLimitsReport, Message::TM, 1);
+		report.appendUint16(reportedDefinitions);
+		for (uint16_t i = nextIndex; i < nextIndex + reportedDefinitions; i++) {
+			appendCheckTransition(report, outOfLimits[i]);
+		}
+		storeMessage(report);
+
+		nextIndex += reportedDefinitions;
+	} while (nextIndex < outOfLimits.size());
 }
 
 void OnBoardMonitoringService::execute(Message& message) {
@@ -67,6 +486,18 @@ void OnBoardMonitoringService::execute(Message& message) {
 		case DeleteAllParameterMonitoringDefinitions:
 			deleteAllParameterMonitoringDefinitions(message);
 			break;
+		case AddParameterMonitoringDefinitions:
+			addParameterMonitoringDefinitions(message);
+			break;
+		case ReportOutOfLimits:
+			reportOutOfLimits(message);
+			break;
+		case EnableParameterMonitoringFunction:
+			enableParameterMonitoringFunction(message);
+			break;
+		case DisableParameterMonitoringFunction:
+			disableParameterMonitoringFunction(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
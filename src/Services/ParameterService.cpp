@@ -18,26 +18,44 @@ void ParameterService::reportParameters(Message& paramIds) {
 	                            ErrorHandler::AcceptanceErrorType::UnacceptableMessage);
 
 	uint16_t numOfIds = paramIds.readUint16();
-	uint16_t numberOfValidIds = 0;
-	for (uint16_t i = 0; i < numOfIds; i++) {
-		if (parameterExists(paramIds.readUint16())) {
-			numberOfValidIds++;
-		}
-	}
-	parameterReport.appendUint16(numberOfValidIds);
-	paramIds.resetRead();
+	uint16_t numberOfInvalidIds = 0;
+	etl::vector<std::pair<uint16_t, std::reference_wrapper<ParameterBase>>, MaxReportedParameters> reportedParameters;
+	uint32_t lockShards = 0;
 
-	numOfIds = paramIds.readUint16();
 	for (uint16_t i = 0; i < numOfIds; i++) {
 		uint16_t currId = paramIds.readUint16();
 		if (auto parameter = getParameter(currId)) {
-			parameterReport.appendUint16(currId);
-			parameter->get().appendValueToMessage(parameterReport);
+			if (reportedParameters.full()) {
+				ErrorHandler::reportInternalError(ErrorHandler::MessageTooLarge);
+				break;
+			}
+			reportedParameters.emplace_back(currId, *parameter);
+			lockShards |= parameter->get().lockShardMask();
 		} else {
-			ErrorHandler::reportError(paramIds, ErrorHandler::GetNonExistingParameter);
+			numberOfInvalidIds++;
 		}
 	}
 
+	parameterReport.appendUint16(reportedParameters.size());
+	uint16_t reportPosition = parameterReport.dataSize;
+
+	// All values in the report must belong to the same instant, so the values are read again if a parameter changes
+	bool consistent = readConsistently(lockShards, [&]() {
+		parameterReport.dataSize = reportPosition;
+
+		for (auto& [id, parameter] : reportedParameters) {
+			parameterReport.appendUint16(id);
+			parameter.get().appendValueToMessage(parameterReport);
+		}
+	});
+	if (not consistent) {
+		ErrorHandler::reportInternalError(ErrorHandler::InconsistentParameterRead);
+	}
+
+	for (uint16_t i = 0; i < numberOfInvalidIds; i++) {
+		ErrorHandler::reportError(paramIds, ErrorHandler::GetNonExistingParameter);
+	}
+
 	storeMessage(parameterReport);
 }
 
@@ -62,6 +80,25 @@ void ParameterService::setParameters(Message& newParamValues) {
 	}
 }
 
+void ParameterService::registerParameters() {
+	uint16_t notificationIndex = 0;
+	for (auto& parameter : parameters) {
+		parameter.second.get().notificationIndex = notificationIndex;
+		parameter.second.get().lockShard = notificationIndex % ECSSParameterLockShards;
+		changeNotifier.registerParameter(notificationIndex, parameter.first);
+		notificationIndex++;
+	}
+}
+
+bool ParameterService::subscribeToParameter(uint16_t parameterId, ParameterChangeNotifier::Callback callback) {
+	auto parameter = getParameter(parameterId);
+	if (not parameter) {
+		return false;
+	}
+
+	return changeNotifier.subscribe(parameter->get().notificationIndex, callback);
+}
+
 void ParameterService::execute(Message& message) {
 	switch (message.messageType) {
 		case ReportParameterValues:
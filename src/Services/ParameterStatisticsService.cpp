@@ -5,6 +5,103 @@
 
 ParameterStatisticsService::ParameterStatisticsService() : evaluationStartTime(TimeGetter::getCurrentTimeCustomCUC()) {}
 
+void ParameterStatisticsService::updateChangedStatistics() {
+	Services.parameterManagement.drainChangedParameters(ParameterChangeNotifier::Statistics, [this](uint16_t parameterId) {
+		auto index = statistics.findIndex(parameterId);
+		if (index and (statistics.getSelfSamplingInterval(*index) == 0)) {
+			sampleParameter(*index);
+		}
+	});
+}
+
+void ParameterStatisticsService::scheduleSampling(uint16_t index) {
+	uint16_t parameterId = statistics.getParameterId(index);
+	uint16_t samplingInterval = statistics.getSelfSamplingInterval(index);
+	if (samplingInterval == 0) {
+		samplingSchedule.cancel(parameterId);
+		return;
+	}
+	samplingSchedule.schedule(parameterId, currentSamplingTime + samplingInterval);
+}
+
+void ParameterStatisticsService::sampleParameter(uint16_t index) {
+	uint16_t parameterId = statistics.getParameterId(index);
+	auto parameter = Services.parameterManagement.getParameter(parameterId);
+	if (not parameter) {
+		return;
+	}
+
+	double value = parameter->get().getValueAsDouble();
+	statistics.updateStatistics(index, value);
+
+	auto windowedStatistic = windowedStatisticsMap.find(parameterId);
+	if (windowedStatistic != windowedStatisticsMap.end()) {
+		auto sampleTime = static_cast<uint32_t>(TimeGetter::now() / TimeGetter::NanosecondsPerMillisecond);
+		windowedStatistic->second.addSample(value, sampleTime);
+	}
+}
+
+bool ParameterStatisticsService::enableWindowedStatistics(uint16_t parameterId, uint32_t maxAge) {
+	if (not statistics.contains(parameterId)) {
+		return false;
+	}
+
+	windowedStatisticsMap.erase(parameterId);
+	windowedStatisticsMap.insert({parameterId, WindowedStatistic<>(maxAge)});
+	return true;
+}
+
+void ParameterStatisticsService::disableWindowedStatistics(uint16_t parameterId) {
+	windowedStatisticsMap.erase(parameterId);
+}
+
+std::optional<std::reference_wrapper<const WindowedStatistic<>>>
+ParameterStatisticsService::getWindowedStatistic(uint16_t parameterId) {
+	auto windowedStatistic = windowedStatisticsMap.find(parameterId);
+	if (windowedStatistic == windowedStatisticsMap.end()) {
+		return {};
+	}
+
+	windowedStatistic->second.expire(static_cast<uint32_t>(TimeGetter::now() / TimeGetter::NanosecondsPerMillisecond));
+	return windowedStatistic->second;
+}
+
+uint32_t ParameterStatisticsService::sampleDueStatistics(uint32_t currentTime) {
+	currentSamplingTime = currentTime;
+
+	samplingSchedule.runDueJobs(currentTime, [&](const auto& job) -> std::optional<uint32_t> {
+		auto index = statistics.findIndex(job.key);
+		if (not index or (statistics.getSelfSamplingInterval(*index) == 0)) {
+			return {};
+		}
+
+		sampleParameter(*index);
+
+		return DeadlineScheduler<ECSSMaxStatisticParameters>::nextPeriodicDeadline(
+		    job.deadline, statistics.getSelfSamplingInterval(*index), currentTime);
+	});
+
+	bool isReporting = periodicStatisticsReportingStatus and (reportingInterval != 0);
+	if (isReporting and DeadlineScheduler<ECSSMaxStatisticParameters>::isDue(nextReportingTime, currentTime)) {
+		parameterStatisticsReport();
+		if (hasAutomaticStatisticsReset) {
+			resetParameterStatistics();
+		}
+		nextReportingTime = DeadlineScheduler<ECSSMaxStatisticParameters>::nextPeriodicDeadline(
+		    nextReportingTime, reportingInterval, currentTime);
+	}
+
+	uint32_t timeUntilNextCall = std::numeric_limits<uint32_t>::max();
+	if (auto nextSamplingTime = samplingSchedule.nextDeadline()) {
+		timeUntilNextCall = *nextSamplingTime - currentTime;
+	}
+	if (isReporting) {
+		timeUntilNextCall = std::min(timeUntilNextCall, nextReportingTime - currentTime);
+	}
+
+	return timeUntilNextCall;
+}
+
 void ParameterStatisticsService::reportParameterStatistics(Message& request) {
 	request.assertTC(ServiceType, MessageType::ReportParameterStatistics);
 	parameterStatisticsReport();
@@ -20,32 +117,22 @@ void ParameterStatisticsService::reportParameterStatistics(Message& request) {
 }
 
 void ParameterStatisticsService::parameterStatisticsReport() {
-	Message report(ServiceType, MessageType::ParameterStatisticsReport, Message::TM, 1);
-	report.append(evaluationStartTime);
 	auto evaluationStopTime = TimeGetter::getCurrentTimeCustomCUC();
-	report.append(evaluationStopTime);
 
-	uint16_t numOfValidParameters = 0;
-	for (auto& currentStatistic: statisticsMap) {
-		uint16_t numOfSamples = currentStatistic.second.sampleCounter;
-		if (numOfSamples == 0) {
-			continue;
-		}
-		numOfValidParameters++;
-	}
-	report.appendUint16(numOfValidParameters);
+	// The statistics are split into as many reports as needed, each of them with the same evaluation times
+	uint16_t nextIndex = 0;
+	do {
+		Message report(ServiceType, MessageType::ParameterStatisticsReport, Message::TM, 1);
+		report.append(evaluationStartTime);
+		report.append(evaluationStopTime);
 
-	for (auto& currentStatistic: statisticsMap) {
-		uint16_t currentId = currentStatistic.first;
-		uint16_t numOfSamples = currentStatistic.second.sampleCounter;
-		if (numOfSamples == 0) {
-			continue;
-		}
-		report.appendUint16(currentId);
-		report.appendUint16(numOfSamples);
-		currentStatistic.second.appendStatisticsToMessage(report);
-	}
-	storeMessage(report);
+		uint16_t numOfValidParameters = 0;
+		uint16_t numOfValidParametersPosition = report.reserveBytes(sizeof(numOfValidParameters));
+		nextIndex = statistics.appendStatisticsToMessage(nextIndex, report, numOfValidParameters);
+		report.patchUint16(numOfValidParametersPosition, numOfValidParameters);
+
+		storeMessage(report);
+	} while (nextIndex < statistics.size());
 }
 
 void ParameterStatisticsService::resetParameterStatistics(Message& request) {
@@ -54,8 +141,9 @@ void ParameterStatisticsService::resetParameterStatistics(Message& request) {
 }
 
 void ParameterStatisticsService::resetParameterStatistics() {
-	for (auto& it: statisticsMap) {
-		it.second.resetStatistics();
+	statistics.resetStatistics();
+	for (auto& it: windowedStatisticsMap) {
+		it.second.reset();
 	}
 	evaluationStartTime = TimeGetter::getCurrentTimeCustomCUC();
 }
@@ -76,6 +164,7 @@ void ParameterStatisticsService::enablePeriodicStatisticsReporting(Message& requ
 	}
 	periodicStatisticsReportingStatus = true;
 	reportingInterval = timeInterval;
+	nextReportingTime = currentSamplingTime + reportingInterval;
 }
 
 void ParameterStatisticsService::disablePeriodicStatisticsReporting(Message& request) {
@@ -98,7 +187,7 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 			}
 			continue;
 		}
-		bool exists = statisticsMap.find(currentId) != statisticsMap.end();
+		auto index = statistics.findIndex(currentId);
 		uint16_t interval = 0;
 		if (supportsSamplingInterval) {
 			interval = request.readUint16();
@@ -107,8 +196,8 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 				continue;
 			}
 		}
-		if (not exists) {
-			if (statisticsMap.size() >= ECSSMaxStatisticParameters) {
+		if (not index) {
+			if (statistics.full()) {
 				ErrorHandler::reportError(request,
 				                          ErrorHandler::ExecutionStartErrorType::MaxStatisticDefinitionsReached);
 				return;
@@ -117,14 +206,15 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 			if (supportsSamplingInterval) {
 				newStatistic.setSelfSamplingInterval(interval);
 			}
-			statisticsMap.insert({currentId, newStatistic});
-			// TODO: start the evaluation of statistics for this parameter.
+			statistics.insert(currentId, newStatistic);
+			index = statistics.findIndex(currentId);
 		} else {
 			if (supportsSamplingInterval) {
-				statisticsMap.at(currentId).setSelfSamplingInterval(interval);
+				statistics.setSelfSamplingInterval(*index, interval);
 			}
-			statisticsMap.at(currentId).resetStatistics();
+			statistics.resetStatistics(*index);
 		}
+		scheduleSampling(*index);
 	}
 }
 
@@ -133,7 +223,9 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 
 	uint16_t numOfIds = request.readUint16();
 	if (numOfIds == 0) {
-		statisticsMap.clear();
+		statistics.clear();
+		windowedStatisticsMap.clear();
+		samplingSchedule.clear();
 		periodicStatisticsReportingStatus = false;
 		return;
 	}
@@ -143,9 +235,11 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 			ErrorHandler::reportError(request, ErrorHandler::GetNonExistingParameter);
 			continue;
 		}
-		statisticsMap.erase(currentId);
+		statistics.erase(currentId);
+		windowedStatisticsMap.erase(currentId);
+		samplingSchedule.cancel(currentId);
 	}
-	if (statisticsMap.empty()) {
+	if (statistics.empty()) {
 		periodicStatisticsReportingStatus = false;
 	}
 }
@@ -156,24 +250,33 @@ void ParameterStatisticsService::reportStatisticsDefinitions(Message& request) {
 }
 
 void ParameterStatisticsService::statisticsDefinitionsReport() {
-	Message definitionsReport(ServiceType, MessageType::ParameterStatisticsDefinitionsReport, Message::TM, 1);
-
 	uint16_t currentReportingInterval = 0;
 	if (periodicStatisticsReportingStatus) {
 		currentReportingInterval = reportingInterval;
 	}
-	definitionsReport.appendUint16(currentReportingInterval);
-	definitionsReport.appendUint16(statisticsMap.size());
+	const uint16_t definitionSize = supportsSamplingInterval ? 2 * sizeof(uint16_t) : sizeof(uint16_t);
 
-	for (auto& currentParam: statisticsMap) {
-		uint16_t currentId = currentParam.first;
-		uint16_t samplingInterval = currentParam.second.selfSamplingInterval;
-		definitionsReport.appendUint16(currentId);
-		if (supportsSamplingInterval) {
-			definitionsReport.appendUint16(samplingInterval);
+	uint16_t index = 0;
+	do {
+		Message definitionsReport(ServiceType, MessageType::ParameterStatisticsDefinitionsReport, Message::TM, 1);
+		definitionsReport.appendUint16(currentReportingInterval);
+		uint16_t numOfDefinitions = 0;
+		uint16_t numOfDefinitionsPosition = definitionsReport.reserveBytes(sizeof(numOfDefinitions));
+
+		for (; index < statistics.size(); index++) {
+			if (definitionsReport.dataSize + definitionSize > ECSSMaxMessageSize) {
+				break;
+			}
+			definitionsReport.appendUint16(statistics.getParameterId(index));
+			if (supportsSamplingInterval) {
+				definitionsReport.appendUint16(statistics.getSelfSamplingInterval(index));
+			}
+			numOfDefinitions++;
 		}
-	}
-	storeMessage(definitionsReport);
+
+		definitionsReport.patchUint16(numOfDefinitionsPosition, numOfDefinitions);
+		storeMessage(definitionsReport);
+	} while (index < statistics.size());
 }
 
 void ParameterStatisticsService::execute(Message& message) {
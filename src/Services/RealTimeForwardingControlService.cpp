@@ -1,5 +1,8 @@
 #include "Services/RealTimeForwardingControlService.hpp"
+#include <algorithm>
 #include <iostream>
+#include "Services/EventReportService.hpp"
+#include "Services/HousekeepingService.hpp"
 
 void RealTimeForwardingControlService::addAllReportsOfApplication(uint8_t applicationID) {
 	for (auto& service: AllMessageTypes::messagesOfService) {
@@ -10,8 +13,7 @@ void RealTimeForwardingControlService::addAllReportsOfApplication(uint8_t applic
 
 void RealTimeForwardingControlService::addAllReportsOfService(uint8_t applicationID, uint8_t serviceType) {
 	for (auto& messageType: AllMessageTypes::messagesOfService[serviceType]) {
-		auto appServicePair = std::make_pair(applicationID, serviceType);
-		applicationProcessConfiguration.definitions[appServicePair].push_back(messageType);
+		applicationProcessConfiguration.addReportType(applicationID, serviceType, messageType);
 	}
 }
 
@@ -88,6 +90,10 @@ bool RealTimeForwardingControlService::maxReportTypesReached(Message& request, u
 
 bool RealTimeForwardingControlService::checkMessage(Message& request, uint8_t applicationID, uint8_t serviceType,
                                                     uint8_t messageType) {
+	if (not ApplicationProcessConfiguration::isForwardable(serviceType, messageType)) {
+		ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::ReportTypeNotForwardable);
+		return false;
+	}
 	if (maxReportTypesReached(request, applicationID, serviceType) or
 	    reportExistsInAppProcessConfiguration(applicationID, serviceType, messageType)) {
 		return false;
@@ -97,9 +103,34 @@ bool RealTimeForwardingControlService::checkMessage(Message& request, uint8_t ap
 
 bool RealTimeForwardingControlService::reportExistsInAppProcessConfiguration(uint8_t applicationID, uint8_t serviceType,
                                                                              uint8_t messageType) {
-	auto key = std::make_pair(applicationID, serviceType);
-	auto& messages = applicationProcessConfiguration.definitions[key];
-	return std::find(messages.begin(), messages.end(), messageType) != messages.end();
+	return applicationProcessConfiguration.isReportTypeForwarded(applicationID, serviceType, messageType);
+}
+
+bool RealTimeForwardingControlService::isReportForwarded(const Message& report) const {
+	if (report.packetType != Message::TM or
+	    std::find(controlledApplications.begin(), controlledApplications.end(), report.applicationId) ==
+	        controlledApplications.end()) {
+		return true;
+	}
+	if (not applicationProcessConfiguration.isReportTypeForwarded(report.applicationId, report.serviceType,
+	                                                              report.messageType)) {
+		return false;
+	}
+
+	if (report.serviceType == HousekeepingService::ServiceType and
+	    report.messageType == HousekeepingService::MessageType::HousekeepingParametersReport and
+	    report.dataSize >= 1) {
+		return housekeepingReportConfiguration.contains(report.applicationId, report.data[0]);
+	}
+
+	if (report.serviceType == EventReportService::ServiceType and
+	    report.messageType >= EventReportService::MessageType::InformativeEventReport and
+	    report.messageType <= EventReportService::MessageType::HighSeverityAnomalyReport and report.dataSize >= 2) {
+		uint16_t eventDefinitionID = (static_cast<uint16_t>(report.data[0]) << 8U) | report.data[1];
+		return not eventReportBlockingConfiguration.contains(report.applicationId, eventDefinitionID);
+	}
+
+	return true;
 }
 
 void RealTimeForwardingControlService::addReportTypesToAppProcessConfiguration(Message& request) {
@@ -138,12 +169,260 @@ void RealTimeForwardingControlService::addReportTypesToAppProcessConfiguration(M
 				if (not checkMessage(request, applicationID, serviceType, messageType)) {
 					continue;
 				}
-				auto key = std::make_pair(applicationID, serviceType);
-				applicationProcessConfiguration.definitions[key].push_back(
-				    messageType);
+				applicationProcessConfiguration.addReportType(applicationID, serviceType, messageType);
+			}
+		}
+	}
+}
+
+void RealTimeForwardingControlService::deleteReportTypesFromAppProcessConfiguration(Message& request) {
+	request.assertTC(ServiceType, MessageType::DeleteReportTypesFromAppProcessConfiguration);
+	uint8_t numOfApplications = request.readUint8();
+
+	if (numOfApplications == 0) {
+		applicationProcessConfiguration.clear();
+		return;
+	}
+
+	for (uint8_t i = 0; i < numOfApplications; i++) {
+		uint8_t applicationID = request.readUint8();
+		uint8_t numOfServices = request.readUint8();
+
+		if (numOfServices == 0) {
+			if (not applicationProcessConfiguration.removeApplication(applicationID)) {
+				ErrorHandler::reportError(request,
+				                          ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+			}
+			continue;
+		}
+
+		for (uint8_t j = 0; j < numOfServices; j++) {
+			uint8_t serviceType = request.readUint8();
+			uint8_t numOfMessages = request.readUint8();
+
+			if (numOfMessages == 0) {
+				if (not applicationProcessConfiguration.removeServiceType(applicationID, serviceType)) {
+					ErrorHandler::reportError(
+					    request, ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+				}
+				continue;
+			}
+
+			for (uint8_t k = 0; k < numOfMessages; k++) {
+				uint8_t messageType = request.readUint8();
+
+				if (not applicationProcessConfiguration.removeReportType(applicationID, serviceType, messageType)) {
+					ErrorHandler::reportError(
+					    request, ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+				}
+			}
+		}
+	}
+}
+
+void RealTimeForwardingControlService::reportAppProcessConfigurationContent(Message& request) {
+	request.assertTC(ServiceType, MessageType::ReportAppProcessConfigurationContent);
+	appProcessConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::appProcessConfigurationContentReport() {
+	Message report = createTM(AppProcessConfigurationContentReport);
+	auto& definitions = applicationProcessConfiguration.definitions;
+
+	// The definitions are sorted by application process, so the service types of each one are next to each other
+	uint8_t numOfApplications = 0;
+	uint8_t previousApplicationID = 0;
+	for (auto& definition: definitions) {
+		uint8_t applicationID = definition.first.first;
+		if (not definition.second.empty() and (numOfApplications == 0 or previousApplicationID != applicationID)) {
+			numOfApplications++;
+			previousApplicationID = applicationID;
+		}
+	}
+	report.appendUint8(numOfApplications);
+
+	auto definition = definitions.begin();
+	while (definition != definitions.end()) {
+		uint8_t applicationID = definition->first.first;
+		uint8_t numOfServices = 0;
+		auto nextApplication = definition;
+		for (; nextApplication != definitions.end() and nextApplication->first.first == applicationID;
+		     nextApplication++) {
+			if (not nextApplication->second.empty()) {
+				numOfServices++;
+			}
+		}
+
+		if (numOfServices > 0) {
+			report.appendUint8(applicationID);
+			report.appendUint8(numOfServices);
+		}
+		for (; definition != nextApplication; definition++) {
+			if (definition->second.empty()) {
+				continue;
+			}
+			report.appendUint8(definition->first.second);
+			report.appendUint8(definition->second.size());
+			for (auto messageType: definition->second) {
+				report.appendUint8(messageType);
+			}
+		}
+	}
+
+	storeMessage(report);
+}
+
+template <typename Identifier, uint16_t IdentifierCount>
+void RealTimeForwardingControlService::addIdentifiers(
+    Message& request, ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration,
+    ErrorHandler::ExecutionStartErrorType invalidIdentifierError) {
+	uint8_t numOfApplications = request.readUint8();
+
+	for (uint8_t i = 0; i < numOfApplications; i++) {
+		uint8_t applicationID = request.readUint8();
+		uint16_t numOfIdentifiers = request.readUint16();
+
+		if (not checkAppControlled(request, applicationID)) {
+			request.skipBytes(numOfIdentifiers * sizeof(Identifier));
+			continue;
+		}
+		if (not configuration.hasSpaceFor(applicationID)) {
+			ErrorHandler::reportError(request,
+			                          ErrorHandler::ExecutionStartErrorType::MaxForwardControlApplicationsReached);
+			request.skipBytes(numOfIdentifiers * sizeof(Identifier));
+			continue;
+		}
+
+		if (numOfIdentifiers == 0) {
+			configuration.addAll(applicationID);
+			continue;
+		}
+
+		// There is space for the application process, so an identifier is only rejected if it is out of range
+		for (uint16_t j = 0; j < numOfIdentifiers; j++) {
+			auto identifier = request.read<Identifier>();
+			if (not configuration.add(applicationID, identifier)) {
+				ErrorHandler::reportError(request, invalidIdentifierError);
+			}
+		}
+	}
+}
+
+template <typename Identifier, uint16_t IdentifierCount>
+void RealTimeForwardingControlService::deleteIdentifiers(
+    Message& request, ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration) {
+	uint8_t numOfApplications = request.readUint8();
+
+	if (numOfApplications == 0) {
+		configuration.clear();
+		return;
+	}
+
+	for (uint8_t i = 0; i < numOfApplications; i++) {
+		uint8_t applicationID = request.readUint8();
+		uint16_t numOfIdentifiers = request.readUint16();
+
+		if (numOfIdentifiers == 0) {
+			if (not configuration.removeAll(applicationID)) {
+				ErrorHandler::reportError(request,
+				                          ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+			}
+			continue;
+		}
+
+		for (uint16_t j = 0; j < numOfIdentifiers; j++) {
+			auto identifier = request.read<Identifier>();
+			if (not configuration.remove(applicationID, identifier)) {
+				ErrorHandler::reportError(request,
+				                          ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition);
+			}
+		}
+	}
+}
+
+template <typename Identifier, uint16_t IdentifierCount>
+void RealTimeForwardingControlService::identifiersContentReport(
+    MessageType messageType, const ForwardControlIdentifiers<Identifier, IdentifierCount>& configuration) {
+	// The ID and the number of identifiers of an application process, which precede its identifiers
+	const uint16_t applicationHeaderSize = sizeof(uint8_t) + sizeof(uint16_t);
+
+	Message report = createTM(messageType);
+	uint8_t numOfApplications = 0;
+	uint16_t numOfApplicationsPosition = report.reserveBytes(sizeof(numOfApplications));
+
+	for (uint8_t i = 0; i < configuration.size(); i++) {
+		auto& identifiers = configuration.identifiersAt(i);
+		uint16_t remainingIdentifiers = identifiers.count();
+		uint16_t identifier = 0;
+		while (remainingIdentifiers != 0) {
+			if (report.dataSize + applicationHeaderSize + sizeof(Identifier) > ECSSMaxMessageSize) {
+				report.patchUint8(numOfApplicationsPosition, numOfApplications);
+				storeMessage(report);
+
+				report = createTM(messageType);
+				numOfApplications = 0;
+				numOfApplicationsPosition = report.reserveBytes(sizeof(numOfApplications));
+			}
+
+			uint16_t fittingIdentifiers =
+			    (ECSSMaxMessageSize - report.dataSize - applicationHeaderSize) / sizeof(Identifier);
+			uint16_t reportedIdentifiers = std::min(remainingIdentifiers, fittingIdentifiers);
+			report.appendUint8(configuration.applicationAt(i));
+			report.appendUint16(reportedIdentifiers);
+			for (uint16_t j = 0; j < reportedIdentifiers; identifier++) {
+				if (identifiers.test(identifier)) {
+					report.append<Identifier>(identifier);
+					j++;
+				}
 			}
+
+			numOfApplications++;
+			remainingIdentifiers -= reportedIdentifiers;
 		}
 	}
+
+	report.patchUint8(numOfApplicationsPosition, numOfApplications);
+	storeMessage(report);
+}
+
+void RealTimeForwardingControlService::addStructuresToHousekeepingConfiguration(Message& request) {
+	request.assertTC(ServiceType, MessageType::AddStructuresToHousekeepingConfiguration);
+	addIdentifiers(request, housekeepingReportConfiguration,
+	               ErrorHandler::ExecutionStartErrorType::InvalidHousekeepingStructureID);
+}
+
+void RealTimeForwardingControlService::deleteStructuresFromHousekeepingConfiguration(Message& request) {
+	request.assertTC(ServiceType, MessageType::DeleteStructuresFromHousekeepingConfiguration);
+	deleteIdentifiers(request, housekeepingReportConfiguration);
+}
+
+void RealTimeForwardingControlService::reportHousekeepingConfigurationContent(Message& request) {
+	request.assertTC(ServiceType, MessageType::ReportHousekeepingConfigurationContent);
+	housekeepingConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::housekeepingConfigurationContentReport() {
+	identifiersContentReport(HousekeepingConfigurationContentReport, housekeepingReportConfiguration);
+}
+
+void RealTimeForwardingControlService::addEventDefinitionsToEventReportBlocking(Message& request) {
+	request.assertTC(ServiceType, MessageType::AddEventDefinitionsToEventReportBlocking);
+	addIdentifiers(request, eventReportBlockingConfiguration,
+	               ErrorHandler::ExecutionStartErrorType::InvalidEventDefinitionID);
+}
+
+void RealTimeForwardingControlService::deleteEventDefinitionsFromEventReportBlocking(Message& request) {
+	request.assertTC(ServiceType, MessageType::DeleteEventDefinitionsFromEventReportBlocking);
+	deleteIdentifiers(request, eventReportBlockingConfiguration);
+}
+
+void RealTimeForwardingControlService::reportEventReportBlockingContent(Message& request) {
+	request.assertTC(ServiceType, MessageType::ReportEventReportBlockingContent);
+	eventReportBlockingContentReport();
+}
+
+void RealTimeForwardingControlService::eventReportBlockingContentReport() {
+	identifiersContentReport(EventReportBlockingContentReport, eventReportBlockingConfiguration);
 }
 
 void RealTimeForwardingControlService::execute(Message& message) {
@@ -151,6 +430,30 @@ void RealTimeForwardingControlService::execute(Message& message) {
 		case AddReportTypesToAppProcessConfiguration:
 			addReportTypesToAppProcessConfiguration(message);
 			break;
+		case DeleteReportTypesFromAppProcessConfiguration:
+			deleteReportTypesFromAppProcessConfiguration(message);
+			break;
+		case ReportAppProcessConfigurationContent:
+			reportAppProcessConfigurationContent(message);
+			break;
+		case AddStructuresToHousekeepingConfiguration:
+			addStructuresToHousekeepingConfiguration(message);
+			break;
+		case DeleteStructuresFromHousekeepingConfiguration:
+			deleteStructuresFromHousekeepingConfiguration(message);
+			break;
+		case ReportHousekeepingConfigurationContent:
+			reportHousekeepingConfigurationContent(message);
+			break;
+		case AddEventDefinitionsToEventReportBlocking:
+			addEventDefinitionsToEventReportBlocking(message);
+			break;
+		case DeleteEventDefinitionsFromEventReportBlocking:
+			deleteEventDefinitionsFromEventReportBlocking(message);
+			break;
+		case ReportEventReportBlockingContent:
+			reportEventReportBlockingContent(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
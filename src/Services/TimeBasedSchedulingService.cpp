@@ -1,20 +1,98 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_TIMESCHEDULING
 
+#include <algorithm>
 #include "Services/TimeBasedSchedulingService.hpp"
 
 TimeBasedSchedulingService::TimeBasedSchedulingService() {
 	serviceType = TimeBasedSchedulingService::ServiceType;
+	enabledSubSchedules.set();
+}
+
+void TimeBasedSchedulingService::deleteActivity(const ScheduledActivity& activity) {
+	groups.remove(scheduledActivities.slotOf(activity));
+	requests.erase(activity.requestHandle);
+	scheduledActivities.erase(activity);
+}
+
+Message TimeBasedSchedulingService::getRequest(const ScheduledActivity& activity) const {
+	return *MessageParser::parseECSSTC(requests.data(activity.requestHandle), requests.length(activity.requestHandle));
+}
+
+void TimeBasedSchedulingService::appendRequest(Message& report, const ScheduledActivity& activity) const {
+	uint16_t length = requests.length(activity.requestHandle);
+	const uint8_t* request = requests.data(activity.requestHandle);
+	report.appendUint16(length);
+	uint16_t position = report.reserveBytes(length);
+	std::copy(request, request + length, report.data + position);
+}
+
+void TimeBasedSchedulingService::appendActivityDetails(Message& report, uint16_t& count,
+                                                       const ScheduledActivity& activity) {
+	// The release time is appended as a 64-bit CUC timestamp, and the request as an octet string
+	uint16_t detailsSize = sizeof(uint64_t) + sizeof(uint16_t) + requests.length(activity.requestHandle);
+#if SUB_SCHEDULES_ENABLED
+	detailsSize += sizeof(activity.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+	detailsSize += sizeof(activity.groupID);
+#endif
+
+	if (report.dataSize + detailsSize > ECSSMaxMessageSize) {
+		storeDetailReport(report, count);
+		report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
+		report.reserveBytes(sizeof(count));
+		count = 0;
+	}
+
+#if SUB_SCHEDULES_ENABLED
+	report.appendUint8(activity.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+	report.appendUint8(activity.groupID);
+#endif
+	report.appendCustomCUCTimeStamp(releaseTimeOf(activity)); // todo: Replace with the time parser
+	appendRequest(report, activity);
+	count++;
+}
+
+void TimeBasedSchedulingService::storeDetailReport(Message& report, uint16_t count) {
+	report.patchUint16(0, count);
+	storeMessage(report);
 }
 
 Time::CustomCUC_t TimeBasedSchedulingService::executeScheduledActivity(Time::CustomCUC_t currentTime) {
-	if (currentTime >= scheduledActivities.front().requestReleaseTime && !scheduledActivities.empty()) {
-		MessageParser::execute(scheduledActivities.front().request);
-		scheduledActivities.pop_front();
+	return releaseDueActivities(currentTime, 1);
+}
+
+Time::CustomCUC_t TimeBasedSchedulingService::releaseDueActivities(Time::CustomCUC_t currentTime,
+                                                                   uint16_t maxActivities) {
+	uint16_t released = 0;
+	while (released < maxActivities) {
+		if (scheduledActivities.empty() || currentTime < releaseTimeOf(scheduledActivities.front())) {
+			break;
+		}
+
+		ScheduledActivity& activity = scheduledActivities.front();
+		if (not enabledSubSchedules[activity.subScheduleID] or not groups.isEnabled(activity.groupID)) {
+			releaseStatistics.skippedActivities++;
+			deleteActivity(activity);
+			continue;
+		}
+
+		uint64_t latency = (currentTime - releaseTimeOf(activity)).elapsed100msTicks;
+		releaseStatistics.releasedActivities++;
+		releaseStatistics.maxReleaseLatency = std::max(releaseStatistics.maxReleaseLatency, latency);
+		releaseStatistics.totalReleaseLatency += latency;
+
+		Message request = getRequest(activity);
+		deleteActivity(activity);
+		MessageParser::execute(request);
+		released++;
 	}
 
 	if (!scheduledActivities.empty()) {
-		return scheduledActivities.front().requestReleaseTime;
+		return releaseTimeOf(scheduledActivities.front());
 	} else {
 		Time::CustomCUC_t infinity;
 		infinity.elapsed100msTicks = std::numeric_limits<decltype(infinity.elapsed100msTicks)>::max();
@@ -36,39 +114,65 @@ void TimeBasedSchedulingService::resetSchedule(Message& request) {
 	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ResetTimeBasedSchedule);
 	executionFunctionStatus = false;
 	scheduledActivities.clear();
-	// todo: Add resetting for sub-schedules and groups, if defined
+	requests.clear();
+	scheduleTimeShift = 0;
+	groups.reset();
+	enabledSubSchedules.set();
 }
 
 void TimeBasedSchedulingService::insertActivities(Message& request) {
 	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities);
 
-	// todo: Get the sub-schedule ID if they are implemented
+	uint8_t subScheduleID = 0;
+#if SUB_SCHEDULES_ENABLED
+	subScheduleID = request.readUint8();
+	if (subScheduleID >= ECSSMaxTimeSchedSubSchedules) {
+		ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
+		return;
+	}
+#endif
+
+	if (scheduledActivities.empty()) {
+		// There are no stored release times to keep the shift for
+		scheduleTimeShift = 0;
+	}
+
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		// todo: Get the group ID first, if groups are used
+		uint8_t groupID = 0;
+#if GROUPS_ENABLED
+		groupID = request.readUint8();
+#endif
 		Time::CustomCUC_t currentTime = TimeGetter::getCurrentTimeCustomCUC();
 
 		Time::CustomCUC_t releaseTime = request.readCustomCUCTimeStamp();
-		if ((scheduledActivities.available() == 0) || (releaseTime < (currentTime + ECSSTimeMarginForActivation))) {
+		uint16_t requestLength = request.readUint16();
+		const uint8_t* requestData = request.data + request.readPosition;
+
+		const uint8_t headerSize = 5;
+		bool isRequestValid = requestLength >= headerSize and
+		                      (request.readPosition + requestLength) <= request.dataSize and
+		                      (requestData[0] >> 4U) == ECSSPUSVersion;
+		if (scheduledActivities.full() || (releaseTime < (currentTime + ECSSTimeMarginForActivation)) ||
+		    not groups.isValid(groupID) || not isRequestValid || not requests.canStore(requestLength)) {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
-			request.skipBytes(ECSSTCRequestStringSize);
 		} else {
-			uint8_t requestData[ECSSTCRequestStringSize] = {0};
-			request.readString(requestData, ECSSTCRequestStringSize);
-			Message receivedTCPacket = MessageParser::parseECSSTC(requestData);
 			ScheduledActivity newActivity;
 
-			newActivity.request = receivedTCPacket;
-			newActivity.requestReleaseTime = releaseTime;
+			newActivity.requestHandle = requests.store(requestData, requestLength);
+			newActivity.requestReleaseTime = releaseTime - scheduleTimeShift;
+			newActivity.subScheduleID = subScheduleID;
+			newActivity.groupID = groupID;
 
 			// todo: When implemented save the source ID
 			newActivity.requestID.applicationID = request.applicationId;
 			newActivity.requestID.sequenceCount = request.packetSequenceCount;
 
-			scheduledActivities.push_back(newActivity);
+			const ScheduledActivity* insertedActivity = scheduledActivities.insert(newActivity);
+			groups.add(scheduledActivities.slotOf(*insertedActivity), groupID);
 		}
+		request.skipBytes(requestLength);
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 }
 
 void TimeBasedSchedulingService::timeShiftAllActivities(Message& request) {
@@ -76,19 +180,17 @@ void TimeBasedSchedulingService::timeShiftAllActivities(Message& request) {
 
 	Time::CustomCUC_t current_time = TimeGetter::getCurrentTimeCustomCUC();
 
-	const auto releaseTimes =
-	    etl::minmax_element(scheduledActivities.begin(), scheduledActivities.end(),
-	                        [](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-		                        return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-	                        });
 	// todo: Define what the time format is going to be
 	Time::RelativeTime relativeOffset = request.readRelativeTime();
-	if ((releaseTimes.first->requestReleaseTime + relativeOffset) < (current_time + ECSSTimeMarginForActivation)) {
+	if (scheduledActivities.empty()) {
+		return;
+	}
+	// The same offset is added to all activities, so their order does not change
+	if ((releaseTimeOf(scheduledActivities.front()) + relativeOffset) <
+	    (current_time + ECSSTimeMarginForActivation)) {
 		ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
 	} else {
-		for (auto& activity: scheduledActivities) {
-			activity.requestReleaseTime += relativeOffset;
-		}
+		scheduleTimeShift += relativeOffset;
 	}
 }
 
@@ -100,28 +202,20 @@ void TimeBasedSchedulingService::timeShiftActivitiesByID(Message& request) {
 	Time::RelativeTime relativeOffset = request.readRelativeTime();
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.readUint8();
-		receivedRequestID.applicationID = request.readUint16();
-		receivedRequestID.sequenceCount = request.readUint16();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			if ((requestIDMatch->requestReleaseTime + relativeOffset) <
+		ScheduledActivity* requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != nullptr) {
+			if ((releaseTimeOf(*requestIDMatch) + relativeOffset) <
 			    (current_time + ECSSTimeMarginForActivation)) {
 				ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 			} else {
-				requestIDMatch->requestReleaseTime += relativeOffset;
+				// Only this activity moves in the release order, without sorting the schedule again
+				scheduledActivities.setReleaseTime(*requestIDMatch, requestIDMatch->requestReleaseTime + relativeOffset);
 			}
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 }
 
 void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
@@ -129,18 +223,10 @@ void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.readUint8();
-		receivedRequestID.applicationID = request.readUint16();
-		receivedRequestID.sequenceCount = request.readUint16();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			scheduledActivities.erase(requestIDMatch);
+		const ScheduledActivity* requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch != nullptr) {
+			deleteActivity(*requestIDMatch);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
@@ -151,90 +237,184 @@ void TimeBasedSchedulingService::detailReportAllActivities(Message& request) {
 	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DetailReportAllScheduledActivities);
 
 	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
-	report.appendUint16(static_cast<uint16_t>(scheduledActivities.size()));
+	uint16_t count = 0;
+	report.reserveBytes(sizeof(count));
 
-	for (auto& activity: scheduledActivities) {
-		// todo: append sub-schedule and group ID if they are defined
+	scheduledActivities.forEachInOrder([this, &report, &count](const ScheduledActivity& activity) {
+		appendActivityDetails(report, count, activity);
+	});
+	storeDetailReport(report, count);
+}
 
-		report.appendCustomCUCTimeStamp(activity.requestReleaseTime);
-		report.appendString(MessageParser::composeECSS(activity.request));
+TimeBasedSchedulingService::RequestID TimeBasedSchedulingService::readRequestID(Message& request) {
+	RequestID requestID;
+	requestID.sourceID = request.readUint8();
+	requestID.applicationID = request.readUint16();
+	requestID.sequenceCount = request.readUint16();
+	return requestID;
+}
+
+void TimeBasedSchedulingService::findActivitiesByID(
+    Message& request, etl::vector<uint16_t, ECSSMaxNumberOfTimeSchedActivities>& matchedActivities) {
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const ScheduledActivity* requestIDMatch = scheduledActivities.find(readRequestID(request));
+
+		if (requestIDMatch == nullptr) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+		} else if (not matchedActivities.full()) {
+			matchedActivities.push_back(scheduledActivities.slotOf(*requestIDMatch));
+		}
 	}
-	storeMessage(report);
+
+	std::sort(matchedActivities.begin(), matchedActivities.end(), [this](uint16_t first, uint16_t second) {
+		return scheduledActivities.isBefore(first, second);
+	});
 }
 
 void TimeBasedSchedulingService::detailReportActivitiesByID(Message& request) {
 	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DetailReportActivitiesById);
 
 	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	etl::vector<uint16_t, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	findActivitiesByID(request, matchedActivities);
+
+	uint16_t count = 0;
+	report.reserveBytes(sizeof(count));
+	for (uint16_t slot: matchedActivities) {
+		appendActivityDetails(report, count, scheduledActivities[slot]);
+	}
+	storeDetailReport(report, count);
+}
+
+void TimeBasedSchedulingService::summaryReportActivitiesByID(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ActivitiesSummaryReportById);
+
+	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport);
+	etl::vector<uint16_t, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	findActivitiesByID(request, matchedActivities);
 
+	report.appendUint16(static_cast<uint16_t>(matchedActivities.size()));
+	for (uint16_t slot: matchedActivities) {
+		const ScheduledActivity& match = scheduledActivities[slot];
+#if SUB_SCHEDULES_ENABLED
+		report.appendUint8(match.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+		report.appendUint8(match.groupID);
+#endif
+		report.appendCustomCUCTimeStamp(releaseTimeOf(match));
+		report.appendUint8(match.requestID.sourceID);
+		report.appendUint16(match.requestID.applicationID);
+		report.appendUint16(match.requestID.sequenceCount);
+	}
+	storeMessage(report);
+}
+
+void TimeBasedSchedulingService::setSubScheduleStatus(Message& request, bool enabled) {
 	uint16_t iterationCount = request.readUint16();
-	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.readUint8();
-		receivedRequestID.applicationID = request.readUint16();
-		receivedRequestID.sequenceCount = request.readUint16();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
+	if (iterationCount == 0) {
+		if (enabled) {
+			enabledSubSchedules.set();
 		} else {
+			enabledSubSchedules.reset();
+		}
+		return;
+	}
+
+	while (iterationCount-- != 0) {
+		uint8_t subScheduleID = request.readUint8();
+		if (subScheduleID >= ECSSMaxTimeSchedSubSchedules) {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
 		}
+		enabledSubSchedules[subScheduleID] = enabled;
 	}
+}
 
-	sortActivitiesReleaseTime(matchedActivities);
+void TimeBasedSchedulingService::setGroupStatus(Message& request, bool enabled) {
+	uint16_t iterationCount = request.readUint16();
+	if (iterationCount == 0) {
+		groups.setAllEnabled(enabled);
+		return;
+	}
 
-	// todo: append sub-schedule and group ID if they are defined
-	report.appendUint16(static_cast<uint16_t>(matchedActivities.size()));
-	for (auto& match: matchedActivities) {
-		report.appendCustomCUCTimeStamp(match.requestReleaseTime); // todo: Replace with the time parser
-		report.appendString(MessageParser::composeECSS(match.request));
+	while (iterationCount-- != 0) {
+		uint8_t groupID = request.readUint8();
+		if (not groups.isValid(groupID)) {
+			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
+		}
+		groups.setEnabled(groupID, enabled);
+	}
+}
+
+#if SUB_SCHEDULES_ENABLED
+void TimeBasedSchedulingService::reportSubScheduleStatus(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportStatusOfSubSchedules);
+
+	Message report = createTM(TimeBasedSchedulingService::MessageType::SubScheduleStatusReport);
+	report.appendUint16(ECSSMaxTimeSchedSubSchedules);
+	for (uint8_t subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+		report.appendUint8(subScheduleID);
+		report.appendBoolean(enabledSubSchedules[subScheduleID]);
 	}
 	storeMessage(report);
 }
 
-void TimeBasedSchedulingService::summaryReportActivitiesByID(Message& request) {
-	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ActivitiesSummaryReportById);
+void TimeBasedSchedulingService::enableSubSchedules(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableSubSchedules);
+	setSubScheduleStatus(request, true);
+}
 
-	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport);
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+void TimeBasedSchedulingService::disableSubSchedules(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableSubSchedules);
+	setSubScheduleStatus(request, false);
+}
+#endif
+
+#if GROUPS_ENABLED
+void TimeBasedSchedulingService::deleteGroups(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteGroups);
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.readUint8();
-		receivedRequestID.applicationID = request.readUint16();
-		receivedRequestID.sequenceCount = request.readUint16();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
-		} else {
+		uint8_t groupID = request.readUint8();
+		if (not groups.isValid(groupID)) {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
+			continue;
 		}
+
+		groups.forEachSlot(groupID, [this](uint16_t slot) {
+			deleteActivity(scheduledActivities[slot]);
+		});
+		groups.setEnabled(groupID, true);
 	}
-	sortActivitiesReleaseTime(matchedActivities);
+}
 
-	// todo: append sub-schedule and group ID if they are defined
-	report.appendUint16(static_cast<uint16_t>(matchedActivities.size()));
-	for (auto& match: matchedActivities) {
-		// todo: append sub-schedule and group ID if they are defined
-		report.appendCustomCUCTimeStamp(match.requestReleaseTime);
-		report.appendUint8(match.requestID.sourceID);
-		report.appendUint16(match.requestID.applicationID);
-		report.appendUint16(match.requestID.sequenceCount);
+void TimeBasedSchedulingService::enableGroups(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableGroups);
+	setGroupStatus(request, true);
+}
+
+void TimeBasedSchedulingService::disableGroups(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableGroups);
+	setGroupStatus(request, false);
+}
+
+void TimeBasedSchedulingService::reportGroupStatus(Message& request) {
+	request.assertTC(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportStatusOfGroups);
+
+	Message report = createTM(TimeBasedSchedulingService::MessageType::GroupStatusReport);
+	report.appendUint16(ECSSMaxTimeSchedGroups);
+	for (uint8_t groupID = 0; groupID < ECSSMaxTimeSchedGroups; groupID++) {
+		report.appendUint8(groupID);
+		report.appendBoolean(groups.isEnabled(groupID));
+		report.appendUint16(groups.size(groupID));
 	}
 	storeMessage(report);
 }
+#endif
 
 void TimeBasedSchedulingService::execute(Message& message) {
 	switch (message.messageType) {
@@ -268,6 +448,31 @@ void TimeBasedSchedulingService::execute(Message& message) {
 		case DetailReportAllScheduledActivities:
 			detailReportAllActivities(message);
 			break;
+#if SUB_SCHEDULES_ENABLED
+		case ReportStatusOfSubSchedules:
+			reportSubScheduleStatus(message);
+			break;
+		case EnableSubSchedules:
+			enableSubSchedules(message);
+			break;
+		case DisableSubSchedules:
+			disableSubSchedules(message);
+			break;
+#endif
+#if GROUPS_ENABLED
+		case DeleteGroups:
+			deleteGroups(message);
+			break;
+		case EnableGroups:
+			enableGroups(message);
+			break;
+		case DisableGroups:
+			disableGroups(message);
+			break;
+		case ReportStatusOfGroups:
+			reportGroupStatus(message);
+			break;
+#endif
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
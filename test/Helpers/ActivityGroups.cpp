@@ -0,0 +1,51 @@
+#include "Helpers/ActivityGroups.hpp"
+#include <vector>
+#include "../Services/ServiceTests.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Activity groups membership") {
+	ActivityGroups<8, 3> groups;
+
+	groups.add(0, 1);
+	groups.add(3, 1);
+	groups.add(5, 1);
+	groups.add(2, 2);
+	CHECK(groups.size(0) == 0);
+	CHECK(groups.size(1) == 3);
+	CHECK(groups.groupOf(2) == 2);
+
+	// Removing from the middle, the front and the back of a list
+	groups.remove(3);
+	std::vector<uint16_t> slots;
+	groups.forEachSlot(1, [&slots](uint16_t slot) { slots.push_back(slot); });
+	CHECK(slots == std::vector<uint16_t>{5, 0});
+
+	groups.remove(5);
+	groups.remove(0);
+	CHECK(groups.size(1) == 0);
+
+	// The activities can be removed while they are visited
+	groups.add(6, 2);
+	groups.add(7, 2);
+	groups.forEachSlot(2, [&groups](uint16_t slot) { groups.remove(slot); });
+	CHECK(groups.size(2) == 0);
+}
+
+TEST_CASE("Activity groups status") {
+	ActivityGroups<8, 3> groups;
+	CHECK(groups.isEnabled(2));
+	CHECK(groups.isValid(2));
+	CHECK_FALSE(groups.isValid(3));
+
+	groups.setEnabled(2, false);
+	CHECK_FALSE(groups.isEnabled(2));
+	CHECK(groups.isEnabled(1));
+
+	groups.setAllEnabled(false);
+	CHECK_FALSE(groups.isEnabled(0));
+
+	groups.add(4, 0);
+	groups.reset();
+	CHECK(groups.isEnabled(0));
+	CHECK(groups.size(0) == 0);
+}
@@ -0,0 +1,136 @@
+#include "Helpers/ActivitySchedule.hpp"
+#include <random>
+#include <vector>
+#include "../Services/ServiceTests.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	struct TestID {
+		uint16_t value = 0;
+
+		bool operator==(const TestID& other) const {
+			return value == other.value;
+		}
+
+		uint32_t hash() const {
+			// A bad hash, so that the probe sequences are long and overlap
+			return value % 4;
+		}
+	};
+
+	struct TestActivity {
+		TestID requestID;
+		uint32_t requestReleaseTime = 0;
+	};
+
+	template <uint16_t Capacity>
+	std::vector<uint32_t> releaseOrder(ActivitySchedule<TestActivity, Capacity>& schedule) {
+		std::vector<uint32_t> times;
+		schedule.forEachInOrder([&times](const TestActivity& activity) { times.push_back(activity.requestReleaseTime); });
+		return times;
+	}
+} // namespace
+
+TEST_CASE("Activity schedule ordering") {
+	ActivitySchedule<TestActivity, 8> schedule;
+	CHECK(schedule.empty());
+
+	schedule.insert({{1}, 30});
+	schedule.insert({{2}, 10});
+	schedule.insert({{3}, 20});
+	schedule.insert({{4}, 10});
+
+	CHECK(schedule.size() == 4);
+	CHECK(releaseOrder(schedule) == std::vector<uint32_t>{10, 10, 20, 30});
+
+	// Activities with the same release time are kept in order of insertion
+	CHECK(schedule.front().requestID.value == 2);
+	schedule.pop_front();
+	CHECK(schedule.front().requestID.value == 4);
+
+	schedule.setReleaseTime(*schedule.find(TestID{1}), 5);
+	CHECK(schedule.front().requestID.value == 1);
+	CHECK(releaseOrder(schedule) == std::vector<uint32_t>{5, 10, 20});
+}
+
+TEST_CASE("Activity schedule lookup") {
+	ActivitySchedule<TestActivity, 4> schedule;
+
+	TestActivity* activity = schedule.insert({{7}, 40});
+	schedule.insert({{7}, 20});
+	schedule.insert({{8}, 30});
+	CHECK(schedule.find(TestID{9}) == nullptr);
+
+	// The earliest of the activities with the same ID is found
+	REQUIRE(schedule.find(TestID{7}) != nullptr);
+	CHECK(schedule.find(TestID{7})->requestReleaseTime == 20);
+
+	schedule.erase(*schedule.find(TestID{7}));
+	CHECK(schedule.find(TestID{7}) == activity);
+
+	schedule.setRequestID(*activity, TestID{9});
+	CHECK(schedule.find(TestID{7}) == nullptr);
+	CHECK(schedule.find(TestID{9}) == activity);
+
+	schedule.insert({{1}, 1});
+	schedule.insert({{2}, 2});
+	CHECK(schedule.full());
+	CHECK(schedule.insert({{3}, 3}) == nullptr);
+
+	schedule.clear();
+	CHECK(schedule.empty());
+	CHECK(schedule.find(TestID{9}) == nullptr);
+}
+
+TEST_CASE("Activity schedule random operations") {
+	const uint16_t capacity = 200;
+	ActivitySchedule<TestActivity, capacity> schedule;
+	std::vector<TestActivity> reference;
+
+	std::mt19937 generator(42);
+	for (int operation = 0; operation < 5000; operation++) {
+		uint16_t id = generator() % 300;
+		uint32_t time = generator() % 1000;
+
+		switch (generator() % 3) {
+			case 0:
+				if (schedule.insert({{id}, time}) != nullptr) {
+					reference.push_back({{id}, time});
+				}
+				break;
+			case 1:
+				if (auto* activity = schedule.find(TestID{id})) {
+					auto match = std::find_if(reference.begin(), reference.end(), [&](const auto& referenceActivity) {
+						return referenceActivity.requestID.value == id and
+						       referenceActivity.requestReleaseTime == activity->requestReleaseTime;
+					});
+					reference.erase(match);
+					schedule.erase(*activity);
+				}
+				break;
+			default:
+				if (auto* activity = schedule.find(TestID{id})) {
+					auto match = std::find_if(reference.begin(), reference.end(), [&](const auto& referenceActivity) {
+						return referenceActivity.requestID.value == id and
+						       referenceActivity.requestReleaseTime == activity->requestReleaseTime;
+					});
+					match->requestReleaseTime = time;
+					schedule.setReleaseTime(*activity, time);
+				}
+				break;
+		}
+
+		REQUIRE(schedule.size() == reference.size());
+	}
+
+	std::vector<uint32_t> expectedTimes;
+	for (const auto& activity: reference) {
+		expectedTimes.push_back(activity.requestReleaseTime);
+	}
+	std::sort(expectedTimes.begin(), expectedTimes.end());
+	CHECK(releaseOrder(schedule) == expectedTimes);
+
+	for (const auto& activity: reference) {
+		CHECK(schedule.find(activity.requestID) != nullptr);
+	}
+}
@@ -0,0 +1,75 @@
+#include "Helpers/DeadlineScheduler.hpp"
+#include "../Services/ServiceTests.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Deadline scheduler ordering") {
+	DeadlineScheduler<4> scheduler;
+	CHECK_FALSE(scheduler.nextDeadline());
+
+	scheduler.schedule(1, 30);
+	scheduler.schedule(2, 10);
+	scheduler.schedule(3, 20);
+	CHECK(scheduler.nextDeadline() == 10);
+
+	etl::vector<uint16_t, 8> runs;
+	scheduler.runDueJobs(25, [&](const auto& job) -> std::optional<uint32_t> {
+		runs.push_back(job.key);
+		return {};
+	});
+
+	REQUIRE(runs.size() == 2);
+	CHECK(runs[0] == 2);
+	CHECK(runs[1] == 3);
+	CHECK(scheduler.size() == 1);
+	CHECK(scheduler.nextDeadline() == 30);
+}
+
+TEST_CASE("Deadline scheduler changes") {
+	DeadlineScheduler<2> scheduler;
+
+	SECTION("Rescheduling replaces the deadline") {
+		scheduler.schedule(1, 30);
+		scheduler.schedule(1, 5);
+		CHECK(scheduler.size() == 1);
+		CHECK(scheduler.nextDeadline() == 5);
+	}
+
+	SECTION("Cancelling") {
+		scheduler.schedule(1, 10);
+		scheduler.schedule(2, 20);
+		scheduler.cancel(1);
+		scheduler.cancel(3);
+		CHECK(scheduler.size() == 1);
+		CHECK(scheduler.nextDeadline() == 20);
+	}
+
+	SECTION("Full scheduler") {
+		CHECK(scheduler.schedule(1, 10));
+		CHECK(scheduler.schedule(2, 10));
+		CHECK_FALSE(scheduler.schedule(3, 10));
+		CHECK(ServiceTests::thrownError(ErrorHandler::MapFull));
+		ServiceTests::reset();
+	}
+}
+
+TEST_CASE("Deadline scheduler periodic jobs") {
+	DeadlineScheduler<2> scheduler;
+	scheduler.schedule(1, UINT32_MAX - 5);
+
+	uint16_t runs = 0;
+	auto runner = [&](const auto& job) -> std::optional<uint32_t> {
+		runs++;
+		return DeadlineScheduler<2>::nextPeriodicDeadline(job.deadline, 10, UINT32_MAX - 5);
+	};
+
+	// The deadline wraps around the end of the time counter
+	scheduler.runDueJobs(UINT32_MAX - 5, runner);
+	CHECK(runs == 1);
+	CHECK(scheduler.nextDeadline() == 4);
+
+	scheduler.runDueJobs(3, runner);
+	CHECK(runs == 1);
+	CHECK(DeadlineScheduler<2>::isDue(4, 4));
+	CHECK(DeadlineScheduler<2>::nextPeriodicDeadline(10, 10, 45) == 55);
+	CHECK(DeadlineScheduler<2>::nextPeriodicDeadline(10, 10, 15) == 20);
+}
@@ -0,0 +1,136 @@
+#include "Helpers/ParameterArena.hpp"
+#include "Message.hpp"
+#include "Services/ParameterService.hpp"
+#include "../Services/ServiceTests.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Parameter arena slot allocation") {
+	ParameterArena<4> arena;
+
+	auto index1 = arena.add<uint8_t>(10, 3);
+	auto index2 = arena.add<uint32_t>(20, 70000);
+	REQUIRE(index1);
+	REQUIRE(index2);
+	CHECK(*index1 == 0);
+	CHECK(*index2 == 1);
+
+	SECTION("Duplicate IDs are rejected") {
+		CHECK_FALSE(arena.add<uint16_t>(10, 5));
+		CHECK(arena.size() == 2);
+	}
+
+	SECTION("Mismatched type") {
+		arena.getValue<uint16_t>(*index1);
+		CHECK(ServiceTests::thrownError(ErrorHandler::ParameterTypeMismatch));
+		ServiceTests::reset();
+	}
+
+	SECTION("Lookup by ID") {
+		CHECK(arena.findIndex(20) == index2);
+		CHECK_FALSE(arena.findIndex(30));
+		CHECK(arena.getId(*index1) == 10);
+		CHECK(arena.getType(*index2) == ParameterType::Uint32);
+	}
+
+	SECTION("Full arena") {
+		CHECK(arena.add<float>(30, 1.5f));
+		CHECK(arena.add<int16_t>(40, -3));
+		CHECK_FALSE(arena.add<bool>(50, true));
+		CHECK(ServiceTests::thrownError(ErrorHandler::MapFull));
+	}
+}
+
+TEST_CASE("Parameter arena values") {
+	ParameterArena<5> arena;
+	uint16_t index1 = *arena.add<uint8_t>(0, 1);
+	uint16_t index2 = *arena.add<uint16_t>(1, 500);
+	uint16_t index3 = *arena.add<int32_t>(2, -70000);
+	uint16_t index4 = *arena.add<float>(3, 14.237f);
+
+	SECTION("Typed access") {
+		arena.setValue<uint16_t>(index2, 1000);
+		CHECK(arena.getValue<uint8_t>(index1) == 1);
+		CHECK(arena.getValue<uint16_t>(index2) == 1000);
+		CHECK(arena.getValue<int32_t>(index3) == -70000);
+	}
+
+	SECTION("Value as double") {
+		CHECK(arena.getValueAsDouble(index3) == Catch::Approx(-70000.0));
+		CHECK(arena.getValueAsDouble(index4) == Catch::Approx(14.237).epsilon(0.001));
+	}
+
+	SECTION("Message appending and setting") {
+		Message request(ParameterService::ServiceType, ParameterService::MessageType::SetParameterValues, Message::TC,
+		                1);
+		request.appendUint8(10);
+		request.appendUint16(1000);
+		request.appendSint32(-5);
+
+		arena.setValueFromMessage(index1, request);
+		arena.setValueFromMessage(index2, request);
+		arena.setValueFromMessage(index3, request);
+
+		Message report(ParameterService::ServiceType, ParameterService::MessageType::ParameterValuesReport,
+		               Message::TM, 1);
+		arena.appendValueToMessage(index1, report);
+		arena.appendValueToMessage(index2, report);
+		arena.appendValueToMessage(index3, report);
+
+		CHECK(report.readUint8() == 10);
+		CHECK(report.readUint16() == 1000);
+		CHECK(report.readSint32() == -5);
+	}
+
+	SECTION("Bulk snapshots") {
+		ParameterArena<5>::Slot slots[5];
+		CHECK(arena.snapshot(slots) == 4);
+		arena.setValue<uint8_t>(index1, 200);
+		CHECK(ParameterArena<5>::decode<uint8_t>(slots[index1]) == 1);
+		CHECK(ParameterArena<5>::decode<uint16_t>(slots[index2]) == 500);
+		CHECK(ParameterArena<5>::decode<float>(slots[index4]) == 14.237f);
+
+		double doubles[5];
+		CHECK(arena.snapshotAsDouble(doubles) == 4);
+		CHECK(doubles[index1] == Catch::Approx(200.0));
+		CHECK(doubles[index2] == Catch::Approx(500.0));
+		CHECK(doubles[index3] == Catch::Approx(-70000.0));
+		CHECK(doubles[index4] == Catch::Approx(14.237).epsilon(0.001));
+	}
+}
+
+TEST_CASE("Parameter arena slots used as parameters") {
+	ParameterArena<4> arena;
+	uint16_t index1 = *arena.add<uint16_t>(0, 7);
+	uint16_t index2 = *arena.add<double>(1, 2.5);
+	ArenaParameter<4> parameter1(arena, index1);
+	ArenaParameter<4> parameter2(arena, index2);
+
+	// Services only see the ParameterBase interface
+	ParameterBase& base1 = parameter1;
+	ParameterBase& base2 = parameter2;
+	CHECK(base1.getValueAsDouble() == Catch::Approx(7.0));
+	CHECK(base2.getValueAsDouble() == Catch::Approx(2.5));
+	CHECK(base1.getValueAsUint64() == 7);
+	CHECK_FALSE(base2.getValueAsUint64());
+
+	Message request(ParameterService::ServiceType, ParameterService::MessageType::SetParameterValues, Message::TC, 1);
+	request.appendUint16(300);
+	request.appendDouble(-4.25);
+	base1.setValueFromMessage(request);
+	base2.setValueFromMessage(request);
+
+	Message report(ParameterService::ServiceType, ParameterService::MessageType::ParameterValuesReport, Message::TM, 1);
+	base1.appendValueToMessage(report);
+	base2.appendValueToMessage(report);
+	CHECK(report.readUint16() == 300);
+	CHECK(report.readDouble() == -4.25);
+
+	// The values are still in the arena, so they can be copied in bulk
+	parameter1.setValue<uint16_t>(12);
+	CHECK(parameter1.getValue<uint16_t>() == 12);
+	double doubles[4];
+	CHECK(arena.snapshotAsDouble(doubles) == 2);
+	CHECK(doubles[index1] == Catch::Approx(12.0));
+	CHECK(doubles[index2] == Catch::Approx(-4.25));
+	CHECK(ServiceTests::countErrors() == 0);
+}
@@ -0,0 +1,91 @@
+#include "Helpers/RequestArena.hpp"
+#include <random>
+#include <vector>
+#include "catch2/catch_all.hpp"
+
+namespace {
+	template <uint16_t Size, uint16_t Capacity>
+	std::vector<uint8_t> entry(const RequestArena<Size, Capacity>& arena, uint16_t handle) {
+		return std::vector<uint8_t>(arena.data(handle), arena.data(handle) + arena.length(handle));
+	}
+} // namespace
+
+TEST_CASE("Request arena storage") {
+	RequestArena<32, 4> arena;
+	CHECK(arena.empty());
+
+	const std::vector<uint8_t> first = {1, 2, 3};
+	const std::vector<uint8_t> second = {4, 5, 6, 7, 8, 9, 10};
+	const std::vector<uint8_t> third = {11};
+
+	auto firstHandle = arena.store(first.data(), first.size());
+	auto secondHandle = arena.store(second.data(), second.size());
+	auto thirdHandle = arena.store(third.data(), third.size());
+	CHECK(arena.size() == 3);
+	CHECK(arena.bytesUsed() == 3 * decltype(arena)::HeaderSize + 11);
+
+	CHECK(entry(arena, firstHandle) == first);
+	CHECK(entry(arena, secondHandle) == second);
+	CHECK(entry(arena, thirdHandle) == third);
+
+	// The entries after the erased one are moved back, and keep their handles
+	arena.erase(firstHandle);
+	CHECK(arena.size() == 2);
+	CHECK(arena.bytesUsed() == 2 * decltype(arena)::HeaderSize + 8);
+	CHECK(entry(arena, secondHandle) == second);
+	CHECK(entry(arena, thirdHandle) == third);
+
+	// The space of the erased entry is reused
+	const std::vector<uint8_t> large(32 - arena.bytesUsed() - decltype(arena)::HeaderSize, 42);
+	CHECK(not arena.canStore(large.size() + 1));
+	auto largeHandle = arena.store(large.data(), large.size());
+	REQUIRE(largeHandle != decltype(arena)::NoHandle);
+	CHECK(entry(arena, largeHandle) == large);
+	CHECK(arena.store(third.data(), 0) == decltype(arena)::NoHandle);
+
+	arena.clear();
+	CHECK(arena.empty());
+	CHECK(arena.bytesUsed() == 0);
+}
+
+TEST_CASE("Request arena handles") {
+	RequestArena<64, 2> arena;
+	const uint8_t data[] = {1, 2};
+
+	auto firstHandle = arena.store(data, 2);
+	arena.store(data, 1);
+	CHECK(not arena.canStore(0));
+	CHECK(arena.store(data, 1) == decltype(arena)::NoHandle);
+
+	arena.erase(firstHandle);
+	CHECK(arena.store(data, 2) == firstHandle);
+}
+
+TEST_CASE("Request arena random operations") {
+	RequestArena<1024, 40> arena;
+	std::vector<std::pair<uint16_t, std::vector<uint8_t>>> reference;
+
+	std::mt19937 generator(7);
+	for (int operation = 0; operation < 5000; operation++) {
+		if (generator() % 2 == 0 or reference.empty()) {
+			std::vector<uint8_t> data(generator() % 64);
+			for (auto& byte: data) {
+				byte = generator();
+			}
+			auto handle = arena.store(data.data(), data.size());
+			if (handle != decltype(arena)::NoHandle) {
+				reference.emplace_back(handle, data);
+			}
+		} else {
+			auto erased = reference.begin() + generator() % reference.size();
+			arena.erase(erased->first);
+			reference.erase(erased);
+		}
+
+		REQUIRE(arena.size() == reference.size());
+	}
+
+	for (const auto& [handle, data]: reference) {
+		CHECK(entry(arena, handle) == data);
+	}
+}
@@ -0,0 +1,74 @@
+#include "Helpers/SeqLock.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Sequence lock validation") {
+	SeqLock lock;
+
+	SECTION("No concurrent write") {
+		uint32_t token = lock.beginRead();
+		CHECK(lock.validateRead(token));
+	}
+
+	SECTION("Write during a read") {
+		uint32_t token = lock.beginRead();
+		lock.beginWrite();
+		CHECK_FALSE(lock.validateRead(token));
+		lock.endWrite();
+		CHECK_FALSE(lock.validateRead(token));
+		CHECK(lock.validateRead(lock.beginRead()));
+	}
+
+	SECTION("Overlapping writers") {
+		uint32_t token = lock.beginRead();
+		lock.beginWrite();
+		lock.beginWrite();
+		lock.endWrite();
+		lock.endWrite();
+		CHECK_FALSE(lock.validateRead(token));
+	}
+}
+
+TEST_CASE("Sequence lock retries inconsistent reads") {
+	SeqLock lock;
+	int protectedValue = 1;
+	int runs = 0;
+	int copy = 0;
+
+	lock.read([&]() {
+		copy = protectedValue;
+		runs++;
+
+		if (runs == 1) {
+			// Simulate a writer that preempts the reader
+			lock.beginWrite();
+			protectedValue = 2;
+			lock.endWrite();
+		}
+	});
+
+	CHECK(runs == 2);
+	CHECK(copy == 2);
+}
+
+TEST_CASE("Sequence lock reads are bounded") {
+	SeqLock lock;
+	int runs = 0;
+
+	SECTION("Reader preempting a writer") {
+		lock.beginWrite();
+		CHECK_FALSE(lock.read([&]() { runs++; }));
+		CHECK(runs == SeqLock::DefaultReadAttempts);
+		lock.endWrite();
+	}
+
+	SECTION("Steady writer") {
+		CHECK_FALSE(lock.read(
+		    [&]() {
+			    runs++;
+			    lock.beginWrite();
+			    lock.endWrite();
+		    },
+		    3));
+		CHECK(runs == 3);
+	}
+}
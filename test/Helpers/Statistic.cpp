@@ -1,5 +1,6 @@
 #include "Helpers/Statistic.hpp"
 #include "Services/ParameterStatisticsService.hpp"
+#include "../Services/ServiceTests.hpp"
 #include "catch2/catch_all.hpp"
 
 TEST_CASE("Statistics updating function") {
@@ -39,6 +40,131 @@ TEST_CASE("Statistics updating function") {
 	}
 }
 
+TEST_CASE("Statistics batch updating") {
+	double values[10] = {8.3001, 2.3, 6.4, 1.1, 8.35, 3.4, 6, 8.31, 4.7, 1.09};
+	Time::CustomCUC_t timestamps[10];
+	for (uint64_t i = 0; i < 10; i++) {
+		timestamps[i].elapsed100msTicks = 100 + i;
+	}
+
+	SECTION("Single batch") {
+		Statistic stat;
+		stat.updateStatistics(values, timestamps);
+
+		CHECK(stat.sampleCounter == 10);
+		CHECK(stat.max == 8.35);
+		CHECK(stat.timeOfMaxValue.elapsed100msTicks == 104);
+		CHECK(stat.min == 1.09);
+		CHECK(stat.timeOfMinValue.elapsed100msTicks == 109);
+		CHECK(stat.mean == Catch::Approx(4.99501).epsilon(0.00001));
+		CHECK(stat.standardDeviation() == Catch::Approx(2.76527).epsilon(0.00001));
+	}
+
+	SECTION("Consecutive batches are equivalent to single samples") {
+		Statistic batched;
+		batched.updateStatistics(etl::span<const double>(values, 3), etl::span<const Time::CustomCUC_t>(timestamps, 3));
+		batched.updateStatistics(etl::span<const double>(values + 3, 7),
+		                         etl::span<const Time::CustomCUC_t>(timestamps + 3, 7));
+
+		Statistic single;
+		for (auto& value: values) {
+			single.updateStatistics(value);
+		}
+
+		CHECK(batched.sampleCounter == single.sampleCounter);
+		CHECK(batched.mean == Catch::Approx(single.mean));
+		CHECK(batched.standardDeviation() == Catch::Approx(single.standardDeviation()));
+		CHECK(batched.timeOfMaxValue.elapsed100msTicks == 104);
+		CHECK(batched.timeOfMinValue.elapsed100msTicks == 109);
+	}
+
+	SECTION("Mismatched timestamps") {
+		Statistic stat;
+		stat.updateStatistics(values, etl::span<const Time::CustomCUC_t>(timestamps, 4));
+
+		CHECK(stat.statisticsAreInitialized());
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSampleBatch));
+		ServiceTests::reset();
+	}
+
+	SECTION("Large offset") {
+		double offsetValues[4] = {1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16};
+		Statistic stat;
+		stat.updateStatistics(offsetValues, etl::span<const Time::CustomCUC_t>(timestamps, 4));
+		for (auto& value: offsetValues) {
+			stat.updateStatistics(value);
+		}
+
+		CHECK(stat.mean == Catch::Approx(1e9 + 10));
+		CHECK(stat.standardDeviation() == Catch::Approx(4.74342).epsilon(0.00001));
+	}
+}
+
+TEST_CASE("Merging statistics") {
+	double values[10] = {8.3001, 2.3, 6.4, 1.1, 8.35, 3.4, 6, 8.31, 4.7, 1.09};
+
+	Statistic first;
+	Statistic second;
+	Statistic all;
+	for (int i = 0; i < 10; i++) {
+		(i < 4 ? first : second).updateStatistics(values[i]);
+		all.updateStatistics(values[i]);
+	}
+
+	first.merge(second);
+	CHECK(first.sampleCounter == 10);
+	CHECK(first.max == 8.35);
+	CHECK(first.min == 1.09);
+	CHECK(first.mean == Catch::Approx(all.mean));
+	CHECK(first.standardDeviation() == Catch::Approx(all.standardDeviation()));
+
+	Statistic empty;
+	empty.merge(first);
+	CHECK(empty.mean == Catch::Approx(all.mean));
+	CHECK(empty.standardDeviation() == Catch::Approx(all.standardDeviation()));
+}
+
+TEST_CASE("Statistics with more samples than a 16-bit counter") {
+	constexpr uint32_t NumberOfSamples = 70000;
+
+	SECTION("Single samples") {
+		Statistic stat;
+		for (uint32_t i = 0; i < NumberOfSamples; i++) {
+			stat.updateStatistics((i % 2 == 0) ? 1.0 : 3.0);
+		}
+
+		CHECK(stat.sampleCounter == NumberOfSamples);
+		CHECK(stat.mean == Catch::Approx(2));
+		CHECK(stat.standardDeviation() == Catch::Approx(1));
+	}
+
+	SECTION("Batch") {
+		static double values[NumberOfSamples];
+		static Time::CustomCUC_t timestamps[NumberOfSamples];
+		std::fill(values, values + NumberOfSamples, 5.0);
+
+		Statistic stat;
+		stat.updateStatistics(values, timestamps);
+		CHECK(stat.sampleCounter == NumberOfSamples);
+		CHECK(stat.mean == Catch::Approx(5));
+	}
+
+	SECTION("Merging") {
+		Statistic first;
+		first.sampleCounter = 40000;
+		first.mean = 1;
+		first.max = 1;
+		first.min = 1;
+		Statistic second = first;
+		second.mean = 3;
+
+		first.merge(second);
+		CHECK(first.sampleCounter == 80000);
+		CHECK(first.mean == Catch::Approx(2));
+		CHECK(first.standardDeviation() == Catch::Approx(1));
+	}
+}
+
 TEST_CASE("Appending of statistics to message") {
 	SECTION("Successful appending of statistics") {
 		Message report(ParameterStatisticsService::ServiceType,
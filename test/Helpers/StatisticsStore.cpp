@@ -0,0 +1,145 @@
+#include "Helpers/StatisticsStore.hpp"
+#include "Services/ParameterStatisticsService.hpp"
+#include "../Services/ServiceTests.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Statistics store definitions") {
+	StatisticsStore<3> store;
+	CHECK(store.empty());
+
+	Statistic definition;
+	definition.setSelfSamplingInterval(20);
+	CHECK(store.insert(30, definition));
+	CHECK(store.insert(10));
+	CHECK(store.insert(20));
+	CHECK_FALSE(store.insert(20));
+
+	SECTION("Statistics are ordered by ID") {
+		REQUIRE(store.size() == 3);
+		CHECK(store.getParameterId(0) == 10);
+		CHECK(store.getParameterId(1) == 20);
+		CHECK(store.getParameterId(2) == 30);
+		CHECK(store.findIndex(30) == 2);
+		CHECK(store.getSelfSamplingInterval(2) == 20);
+		CHECK_FALSE(store.findIndex(15));
+	}
+
+	SECTION("Full store") {
+		CHECK(store.full());
+		CHECK_FALSE(store.insert(40));
+		CHECK(ServiceTests::thrownError(ErrorHandler::MapFull));
+		ServiceTests::reset();
+	}
+
+	SECTION("Removal") {
+		store.erase(10);
+		store.erase(15);
+		REQUIRE(store.size() == 2);
+		CHECK(store.getParameterId(0) == 20);
+		CHECK(store.getParameterId(1) == 30);
+		CHECK(store.getSelfSamplingInterval(1) == 20);
+
+		store.clear();
+		CHECK(store.empty());
+	}
+}
+
+TEST_CASE("Statistics store updates") {
+	StatisticsStore<2> store;
+	store.insert(1);
+	store.insert(2);
+
+	double values[10] = {8.3001, 2.3, 6.4, 1.1, 8.35, 3.4, 6, 8.31, 4.7, 1.09};
+	Statistic reference;
+	for (double value: values) {
+		store.updateStatistics(1, value);
+		reference.updateStatistics(value);
+	}
+
+	Statistic statistic = store.get(1);
+	CHECK(statistic.sampleCounter == 10);
+	CHECK(statistic.max == 8.35);
+	CHECK(statistic.min == 1.09);
+	CHECK(statistic.mean == Catch::Approx(reference.mean));
+	CHECK(statistic.standardDeviation() == Catch::Approx(2.76527).epsilon(0.00001));
+	CHECK(store.get(0).statisticsAreInitialized());
+
+	store.setSelfSamplingInterval(1, 5);
+	store.resetStatistics(1);
+	CHECK(store.get(1).statisticsAreInitialized());
+	CHECK(store.getSelfSamplingInterval(1) == 5);
+
+	store.updateStatistics(0, 3);
+	store.resetStatistics();
+	CHECK(store.get(0).statisticsAreInitialized());
+
+	SECTION("Batches and merging") {
+		Time::CustomCUC_t timestamps[4] = {};
+		store.updateStatistics(0, etl::span<const double>(values, 4), timestamps);
+
+		Statistic remaining;
+		for (int i = 4; i < 10; i++) {
+			remaining.updateStatistics(values[i]);
+		}
+		store.merge(0, remaining);
+
+		Statistic merged = store.get(0);
+		CHECK(merged.sampleCounter == 10);
+		CHECK(merged.mean == Catch::Approx(reference.mean));
+		CHECK(merged.standardDeviation() == Catch::Approx(reference.standardDeviation()));
+	}
+
+	SECTION("More samples than the report can count") {
+		Statistic many = reference;
+		many.sampleCounter = 70000;
+		store.set(0, many);
+		CHECK(store.getSampleCounter(0) == 70000);
+
+		Message report(ParameterStatisticsService::ServiceType,
+		               ParameterStatisticsService::MessageType::ParameterStatisticsReport, Message::TM, 1);
+		uint16_t appendedStatistics = 0;
+		store.appendStatisticsToMessage(0, report, appendedStatistics);
+		CHECK(appendedStatistics == 1);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readUint16() == UINT16_MAX);
+	}
+}
+
+TEST_CASE("Statistics store reports") {
+	constexpr uint16_t NumberOfStatistics = 200;
+	using Store = StatisticsStore<NumberOfStatistics>;
+	constexpr uint16_t StatisticsPerReport = ECSSMaxMessageSize / Store::ReportedStatisticSize;
+
+	Store store;
+	for (uint16_t id = 0; id < NumberOfStatistics; id++) {
+		store.insert(id);
+		if (id != 1) {
+			store.updateStatistics(id, id);
+		}
+	}
+
+	uint16_t reportedStatistics = 0;
+	uint16_t numberOfReports = 0;
+	uint16_t nextIndex = 0;
+	do {
+		Message report(ParameterStatisticsService::ServiceType,
+		               ParameterStatisticsService::MessageType::ParameterStatisticsReport, Message::TM, 1);
+		uint16_t appendedStatistics = 0;
+		nextIndex = store.appendStatisticsToMessage(nextIndex, report, appendedStatistics);
+
+		CHECK(report.dataSize <= ECSSMaxMessageSize);
+		CHECK(report.dataSize == appendedStatistics * Store::ReportedStatisticSize);
+		if (numberOfReports == 0) {
+			// The statistic without samples is skipped
+			CHECK(report.readUint16() == 0);
+			report.skipBytes(Store::ReportedStatisticSize - sizeof(uint16_t));
+			CHECK(report.readUint16() == 2);
+		}
+
+		reportedStatistics += appendedStatistics;
+		numberOfReports++;
+	} while (nextIndex < store.size());
+
+	CHECK(reportedStatistics == NumberOfStatistics - 1);
+	CHECK(numberOfReports == (NumberOfStatistics - 1 + StatisticsPerReport - 1) / StatisticsPerReport);
+}
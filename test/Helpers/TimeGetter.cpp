@@ -0,0 +1,49 @@
+#include "Helpers/TimeGetter.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Platform time") {
+	// The test platform is fixed at 10 Apr 2020, 10:15:00
+	CHECK(TimeGetter::getCurrentTimeCustomCUC().elapsed100msTicks == 86769000);
+
+	UTCTimestamp expectedTime(2020, 4, 10, 10, 15, 0);
+	bool cond = (TimeGetter::getCurrentTimeUTC() == expectedTime);
+	CHECK(cond);
+}
+
+TEST_CASE("Simulated clock") {
+	TimeGetter::setClockSource(SimulatedClock::now);
+	SimulatedClock::set(0);
+
+	SECTION("Time formats") {
+		UTCTimestamp epoch(Time::Epoch.year, Time::Epoch.month, Time::Epoch.day, 0, 0, 0);
+		bool cond = (TimeGetter::getCurrentTimeUTC() == epoch);
+		CHECK(cond);
+
+		// 29 Feb 2024, 23:59:59.95
+		SimulatedClock::advance((Time::daysFromCivil(2024, 3, 1) - Time::EpochDaysFromUnix) * Time::SecondsPerDay *
+		                            TimeGetter::NanosecondsPerSecond -
+		                        50000000);
+		CHECK(TimeGetter::getCurrentTimeCustomCUC().elapsed100msTicks ==
+		      (SimulatedClock::now() / TimeGetter::NanosecondsPerTick));
+
+		UTCTimestamp leapDay(2024, 2, 29, 23, 59, 59);
+		cond = (TimeGetter::getCurrentTimeUTC() == leapDay);
+		CHECK(cond);
+	}
+
+	SECTION("Cached CUC timestamps") {
+		SimulatedClock::set(1000 * TimeGetter::NanosecondsPerSecond);
+		auto timestamp = TimeGetter::getCurrentTimeCUC<3, 2>();
+		CHECK(timestamp == TimeStamp<3, 2>(1000).toCUCtimestamp());
+
+		// The timestamp only changes once per tick
+		SimulatedClock::advance(TimeGetter::NanosecondsPerTick - 1);
+		CHECK(TimeGetter::getCurrentTimeCUC<3, 2>() == timestamp);
+
+		SimulatedClock::advance(1);
+		Time::CustomCUC_t nextTick{10001};
+		CHECK(TimeGetter::getCurrentTimeCUC<3, 2>() == TimeStamp<3, 2>(nextTick).toCUCtimestamp());
+	}
+
+	TimeGetter::setClockSource(nullptr);
+}
@@ -0,0 +1,90 @@
+#include "Helpers/WindowedStatistic.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Quantile sketch") {
+	QuantileSketch<> sketch;
+	CHECK(sketch.getQuantile(0.5) == 0);
+
+	for (int value = 1; value <= 100; value++) {
+		sketch.add(value);
+	}
+	CHECK(sketch.size() == 100);
+	CHECK(sketch.getQuantile(0.5) == Catch::Approx(50).epsilon(0.05));
+	CHECK(sketch.getQuantile(0.95) == Catch::Approx(95).epsilon(0.05));
+	CHECK(sketch.getQuantile(0.99) == Catch::Approx(99).epsilon(0.05));
+	CHECK(sketch.getQuantile(0) == Catch::Approx(1).epsilon(0.051)); // On a bucket boundary
+
+	SECTION("Removal") {
+		for (int value = 51; value <= 100; value++) {
+			sketch.remove(value);
+		}
+		CHECK(sketch.size() == 50);
+		CHECK(sketch.getQuantile(1) == Catch::Approx(50).epsilon(0.05));
+	}
+
+	SECTION("Negative values and zero") {
+		sketch.clear();
+		sketch.add(-20);
+		sketch.add(-10);
+		sketch.add(0);
+		sketch.add(10);
+		sketch.add(20);
+		CHECK(sketch.getQuantile(0) == Catch::Approx(-20).epsilon(0.05));
+		CHECK(sketch.getQuantile(0.25) == Catch::Approx(-10).epsilon(0.05));
+		CHECK(sketch.getQuantile(0.5) == 0);
+		CHECK(sketch.getQuantile(1) == Catch::Approx(20).epsilon(0.05));
+	}
+}
+
+TEST_CASE("Windowed statistic with a sample limit") {
+	WindowedStatistic<4> statistic;
+	CHECK(statistic.size() == 0);
+	CHECK(statistic.getMax() == -std::numeric_limits<double>::infinity());
+
+	double values[6] = {5, 1, 3, 2, 4, 6};
+	for (uint32_t i = 0; i < 4; i++) {
+		statistic.addSample(values[i], i);
+	}
+	CHECK(statistic.getMax() == 5);
+	CHECK(statistic.getMin() == 1);
+	CHECK(statistic.getMean() == Catch::Approx(2.75));
+
+	// The maximum and the minimum leave the window one after the other
+	statistic.addSample(values[4], 4);
+	CHECK(statistic.size() == 4);
+	CHECK(statistic.getMax() == 4);
+	CHECK(statistic.getMin() == 1);
+
+	statistic.addSample(values[5], 5);
+	CHECK(statistic.getMax() == 6);
+	CHECK(statistic.getMin() == 2);
+	CHECK(statistic.getMean() == Catch::Approx(3.75));
+	CHECK(statistic.getStandardDeviation() == Catch::Approx(1.47902).epsilon(0.0001));
+	CHECK(statistic.getPercentile(100) == Catch::Approx(6).epsilon(0.05));
+
+	statistic.reset();
+	CHECK(statistic.size() == 0);
+	CHECK(statistic.getMean() == 0);
+}
+
+TEST_CASE("Windowed statistic with a max age") {
+	WindowedStatistic<8> statistic(100);
+
+	statistic.addSample(10, 0);
+	statistic.addSample(30, 50);
+	statistic.addSample(20, 90);
+	CHECK(statistic.getMax() == 30);
+
+	statistic.addSample(15, 120);
+	CHECK(statistic.size() == 3);
+	CHECK(statistic.getMin() == 15);
+
+	statistic.expire(190);
+	CHECK(statistic.size() == 1);
+	CHECK(statistic.getMax() == 15);
+	CHECK(statistic.getMean() == Catch::Approx(15));
+
+	statistic.expire(220);
+	CHECK(statistic.size() == 0);
+	CHECK(statistic.getStandardDeviation() == 0);
+}
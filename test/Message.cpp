@@ -236,6 +236,27 @@ TEST_CASE("Requirement 7.3.13 (Packet)", "[message][ecss]") {
 	CHECK(static_cast<int>(telecommand.packetType) == 1);
 }
 
+TEST_CASE("Reserving and patching fields", "[message]") {
+	Message message(0, 0, Message::TM, 0);
+
+	uint16_t countPosition = message.reserveBytes(2);
+	message.appendUint8(12);
+	uint16_t flagPosition = message.reserveBytes(1);
+	message.appendUint32(0xABCDEF12);
+
+	REQUIRE(message.dataSize == 8);
+	CHECK(countPosition == 0);
+	CHECK(flagPosition == 3);
+
+	message.patchUint16(countPosition, 0x1234);
+	message.patchUint8(flagPosition, 0x56);
+
+	CHECK(message.readUint16() == 0x1234);
+	CHECK(message.readUint8() == 12);
+	CHECK(message.readUint8() == 0x56);
+	CHECK(message.readUint32() == 0xABCDEF12);
+}
+
 TEST_CASE("Spare field", "[message]") {
 	Message message1(0, 0, Message::TM, 0);
 
@@ -1,6 +1,7 @@
 #include <Message.hpp>
 #include <ServicePool.hpp>
 #include <Services/EventActionService.hpp>
+#include <Services/TestService.hpp>
 #include <catch2/catch_all.hpp>
 #include <cstring>
 #include <etl/String.hpp>
@@ -8,6 +9,19 @@
 
 EventActionService& eventActionService = Services.eventAction;
 
+/**
+ * @return A TC[17,1] or TC[17,3] request, in the format stored by event-action definitions
+ */
+String<ECSSTCRequestStringSize> createTestRequest(uint8_t messageType = TestService::MessageType::AreYouAliveTest) {
+	Message request(TestService::ServiceType, messageType, Message::TC, 0);
+	if (messageType == TestService::MessageType::OnBoardConnectionTest) {
+		request.appendUint16(40);
+	}
+	String<CCSDSMaxMessageSize> composedRequest = MessageParser::composeECSS(request);
+	return String<ECSSTCRequestStringSize>(reinterpret_cast<const uint8_t*>(composedRequest.data()),
+	                                       composedRequest.size());
+}
+
 TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 
 	// Add a message that is too large to check for the corresponding error
@@ -27,36 +41,39 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 	message1.appendEnum16(0);
 	message1.appendEnum16(2);
 	message1.appendEnum16(1);
-	data = "01234";
-	message1.appendString(data);
+	String<ECSSTCRequestStringSize> request = createTestRequest();
+	message1.appendString(request);
 	MessageParser::execute(message1);
 
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(2)->second.applicationId == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(2)->second.eventDefinitionID == 2);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(2)->second.enabled == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(2)->second.request.compare(data) == 0);
+	CHECK(eventActionService.findEventActionDefinition(2, 1)->applicationId == 0);
+	CHECK(eventActionService.findEventActionDefinition(2, 1)->eventDefinitionID == 2);
+	CHECK(eventActionService.findEventActionDefinition(2, 1)->enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(2, 1)->request.serviceType == TestService::ServiceType);
 
 	// Add a second event-action definition
 	Message message2(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
 	message2.appendEnum16(1);
 	message2.appendEnum16(3);
 	message2.appendEnum16(1);
-	data = "456";
-	message2.appendString(data);
+	request = createTestRequest(TestService::MessageType::OnBoardConnectionTest);
+	message2.appendString(request);
 	MessageParser::execute(message2);
 
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(3)->second.applicationId == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(3)->second.eventDefinitionID == 3);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(3)->second.enabled == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(3)->second.request.compare(data) == 0);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->applicationId == 1);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->eventDefinitionID == 3);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->request.serviceType == TestService::ServiceType);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->request.messageType ==
+	      TestService::MessageType::OnBoardConnectionTest);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->request.dataSize == 2);
+	CHECK(eventActionService.findEventActionDefinition(3, 1)->request.toMessage().readUint16() == 40);
 
 	// Adding the same message to check for error
 	Message message3(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
 	message3.appendEnum16(1);
 	message3.appendEnum16(3);
 	message3.appendEnum16(1);
-	data = "456";
-	message3.appendString(data);
+	message3.appendString(request);
 	MessageParser::execute(message3);
 	CHECK(ServiceTests::thrownError(ErrorHandler::EventActionDefinitionIDExistsError));
 	CHECK(ServiceTests::countErrors() == 2);
@@ -69,7 +86,7 @@ TEST_CASE("Delete event-action definitions TC[19,2]", "[service][st19]") {
 	message0.appendEnum16(1);
 	message0.appendEnum16(0);
 	message0.appendEnum16(1);
-	String<64> data = "0";
+	String<ECSSTCRequestStringSize> data = createTestRequest();
 	message0.appendString(data);
 	MessageParser::execute(message0);
 
@@ -77,7 +94,6 @@ TEST_CASE("Delete event-action definitions TC[19,2]", "[service][st19]") {
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
-	data = "1";
 	message1.appendString(data);
 	MessageParser::execute(message1);
 
@@ -85,7 +101,6 @@ TEST_CASE("Delete event-action definitions TC[19,2]", "[service][st19]") {
 	message2.appendEnum16(1);
 	message2.appendEnum16(2);
 	message2.appendEnum16(1);
-	data = "2";
 	message2.appendString(data);
 	MessageParser::execute(message2);
 
@@ -98,17 +113,17 @@ TEST_CASE("Delete event-action definitions TC[19,2]", "[service][st19]") {
 
 	// Checking the values after deleting some definitions
 
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.applicationId == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.eventDefinitionID == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.request.compare("0") == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->applicationId == 1);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->eventDefinitionID == 0);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->request.serviceType == TestService::ServiceType);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 0);
 
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.applicationId == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.eventDefinitionID == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.request.compare("1") == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->applicationId == 1);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->eventDefinitionID == 1);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->request.serviceType == TestService::ServiceType);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 0);
 
-	CHECK(eventActionService.eventActionDefinitionMap.find(2) == eventActionService.eventActionDefinitionMap.end());
+	CHECK(eventActionService.findEventActionDefinition(2, 1) == nullptr);
 
 	// Enabling a definition to check for errors in the case of an attempt to delete it
 	Message message8(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -158,7 +173,7 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	message0.appendEnum16(1);
 	message0.appendEnum16(0);
 	message0.appendEnum16(1);
-	String<64> data = "0";
+	String<ECSSTCRequestStringSize> data = createTestRequest();
 	message0.appendString(data);
 	MessageParser::execute(message0);
 
@@ -166,7 +181,6 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
-	data = "1";
 	message1.appendString(data);
 	MessageParser::execute(message1);
 
@@ -174,7 +188,6 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	message2.appendEnum16(1);
 	message2.appendEnum16(2);
 	message2.appendEnum16(1);
-	data = "2";
 	message2.appendString(data);
 	MessageParser::execute(message2);
 
@@ -182,7 +195,6 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	message3.appendEnum16(1);
 	message3.appendEnum16(3);
 	message3.appendEnum16(1);
-	data = "3";
 	message3.appendString(data);
 	MessageParser::execute(message3);
 
@@ -190,7 +202,6 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	message4.appendEnum16(1);
 	message4.appendEnum16(4);
 	message4.appendEnum16(1);
-	data = "4";
 	message4.appendString(data);
 	MessageParser::execute(message4);
 
@@ -198,8 +209,9 @@ TEST_CASE("Delete all event-action definitions TC[19,3]", "[service][st19]") {
 	MessageParser::execute(message);
 
 	// Checking the content of the map
-	for (int i = 0; i < 256; i++) {
-		CHECK(eventActionService.eventActionDefinitionMap.find(i) == eventActionService.eventActionDefinitionMap.end());
+	CHECK(eventActionService.eventActionDefinitions.empty());
+	for (uint16_t i = 0; i < 5; i++) {
+		CHECK(eventActionService.findEventActionDefinition(i, 1) == nullptr);
 	}
 }
 
@@ -210,7 +222,7 @@ TEST_CASE("Enable event-action definitions TC[19,4]", "[service][st19]") {
 	message0.appendEnum16(1);
 	message0.appendEnum16(0);
 	message0.appendEnum16(1);
-	String<64> data = "0";
+	String<ECSSTCRequestStringSize> data = createTestRequest();
 	message0.appendString(data);
 	MessageParser::execute(message0);
 
@@ -218,13 +230,12 @@ TEST_CASE("Enable event-action definitions TC[19,4]", "[service][st19]") {
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
-	data = "00";
 	message1.appendString(data);
 	MessageParser::execute(message1);
 
 	// Checking their enabled status
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 0);
 
 	// Creating a message to enable the previous messages
 	Message message3(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -238,8 +249,8 @@ TEST_CASE("Enable event-action definitions TC[19,4]", "[service][st19]") {
 	MessageParser::execute(message3);
 
 	// Checking if the messages are enabled
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 1);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 1);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 1);
 
 	// Checking for errors in the case of an attempt to enable an unknown definition
 	Message message7(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -270,7 +281,7 @@ TEST_CASE("Disable event-action definitions TC[19,5]", "[service][st19]") {
 	message0.appendEnum16(1);
 	message0.appendEnum16(0);
 	message0.appendEnum16(1);
-	String<64> data = "0";
+	String<ECSSTCRequestStringSize> data = createTestRequest();
 	message0.appendString(data);
 	MessageParser::execute(message0);
 
@@ -278,13 +289,12 @@ TEST_CASE("Disable event-action definitions TC[19,5]", "[service][st19]") {
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
 	message1.appendEnum16(1);
-	data = "00";
 	message1.appendString(data);
 	MessageParser::execute(message1);
 
 	// Checking their enabled status
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 0);
 
 	// Creating a message to enable the previous messages
 	Message message3(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -298,8 +308,8 @@ TEST_CASE("Disable event-action definitions TC[19,5]", "[service][st19]") {
 	MessageParser::execute(message3);
 
 	// Checking if the messages are enabled
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 1);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 1);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 1);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 1);
 
 	// Creating a message to enable the previous messages
 	Message message4(EventActionService::ServiceType, EventActionService::MessageType::DisableEventAction, Message::TC, 0);
@@ -313,8 +323,8 @@ TEST_CASE("Disable event-action definitions TC[19,5]", "[service][st19]") {
 	MessageParser::execute(message4);
 
 	// Checking if the messages are enabled
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(0)->second.enabled == 0);
-	CHECK(eventActionService.eventActionDefinitionMap.lower_bound(1)->second.enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(0, 1)->enabled == 0);
+	CHECK(eventActionService.findEventActionDefinition(1, 1)->enabled == 0);
 
 	// Checking for errors in the case of an attempt to enable an unknown definition
 	Message message7(EventActionService::ServiceType, EventActionService::MessageType::DisableEventAction, Message::TC, 0);
@@ -357,7 +367,7 @@ TEST_CASE("Event-action status report TM[19,7]", "[service][st19]") {
 	message0.appendEnum16(1);
 	message0.appendEnum16(0);
 	message0.appendEnum16(1);
-	String<64> data = "0";
+	String<ECSSTCRequestStringSize> data = createTestRequest();
 	message0.appendString(data);
 	MessageParser::execute(message0);
 
@@ -365,7 +375,6 @@ TEST_CASE("Event-action status report TM[19,7]", "[service][st19]") {
 	message1.appendEnum16(1);
 	message1.appendEnum16(2);
 	message1.appendEnum16(1);
-	data = "2";
 	message1.appendString(data);
 	MessageParser::execute(message1);
 
@@ -410,5 +419,212 @@ TEST_CASE("Disable event-action function TC[19,9]", "[service][st19]") {
 	CHECK(eventActionService.getEventActionFunctionStatus() == false);
 }
 
+TEST_CASE("Add invalid event-action definitions TC[19,1]", "[service][st19]") {
+	auto addDefinition = [](uint16_t eventDefinitionID, uint16_t eventActionDefinitionID,
+	                        const String<ECSSTCRequestStringSize>& request) {
+		Message message(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC,
+		                0);
+		message.appendEnum16(0);
+		message.appendEnum16(eventDefinitionID);
+		message.appendEnum16(eventActionDefinitionID);
+		message.appendString(request);
+		MessageParser::execute(message);
+	};
+
+	// A request that is not a valid TC is rejected when it is added, instead of when it is executed
+	addDefinition(1, 1, "01234");
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::UnacceptableMessage) == 1);
+
+	// Event definition IDs beyond the table
+	addDefinition(ECSSEventActionEventDefinitionCount, 1, createTestRequest());
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::EventActionUnknownEventDefinitionError) == 1);
+
+	// Too many actions for the same event
+	for (uint16_t i = 0; i < ECSSMaxEventActionsPerEvent + 1; i++) {
+		addDefinition(1, i, createTestRequest());
+	}
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::EventActionDefinitionsMapIsFull) == 1);
+	CHECK(ServiceTests::countErrors() == 3);
+	CHECK(eventActionService.eventActionDefinitions.size() == ECSSMaxEventActionsPerEvent);
+}
+
+TEST_CASE("Delete event-action definitions of several events TC[19,2]", "[service][st19]") {
+	for (uint16_t eventID = 0; eventID < 3; eventID++) {
+		for (uint16_t eventActionID = 0; eventActionID < 3; eventActionID++) {
+			Message message(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction,
+			                Message::TC, 0);
+			message.appendEnum16(0);
+			message.appendEnum16(eventID);
+			message.appendEnum16(eventActionID);
+			message.appendString(createTestRequest());
+			MessageParser::execute(message);
+		}
+	}
+
+	// Delete definitions from the start, the middle and the end of the pool
+	Message message(EventActionService::ServiceType, EventActionService::MessageType::DeleteEventAction, Message::TC,
+	                0);
+	message.appendUint16(3);
+	for (auto [eventID, eventActionID]: {std::pair{0, 0}, std::pair{1, 1}, std::pair{2, 2}}) {
+		message.appendEnum16(0);
+		message.appendEnum16(eventID);
+		message.appendEnum16(eventActionID);
+	}
+	MessageParser::execute(message);
+	CHECK(ServiceTests::countErrors() == 0);
+
+	CHECK(eventActionService.eventActionDefinitions.size() == 6);
+	for (uint16_t eventID = 0; eventID < 3; eventID++) {
+		for (uint16_t eventActionID = 0; eventActionID < 3; eventActionID++) {
+			auto* definition = eventActionService.findEventActionDefinition(eventID, eventActionID);
+			if (eventID == eventActionID) {
+				CHECK(definition == nullptr);
+			} else {
+				REQUIRE(definition != nullptr);
+				CHECK(definition->eventDefinitionID == eventID);
+				CHECK(definition->eventActionDefinitionID == eventActionID);
+			}
+		}
+	}
+}
+
 TEST_CASE("Execute a TC request", "[service][st19]") {
+	Message message(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+	message.appendEnum16(0);
+	message.appendEnum16(EventReportService::LowSeverityUnknownEvent);
+	message.appendEnum16(1);
+	message.appendString(createTestRequest());
+	MessageParser::execute(message);
+
+	// Disabled definitions are not executed
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(eventActionService.executePendingActions(0) == 0);
+	CHECK(ServiceTests::count() == 1);
+
+	Message enableMessage(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction,
+	                      Message::TC, 0);
+	enableMessage.appendUint16(0);
+	MessageParser::execute(enableMessage);
+
+	// The action is only executed when the queue is processed
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(ServiceTests::count() == 2);
+	CHECK(eventActionService.getQueueDepth() == 1);
+	CHECK(eventActionService.executePendingActions(0) == 1);
+	CHECK(eventActionService.getQueueDepth() == 0);
+	REQUIRE(ServiceTests::count() == 3);
+	CHECK(ServiceTests::get(2).serviceType == TestService::ServiceType);
+	CHECK(ServiceTests::get(2).messageType == TestService::MessageType::AreYouAliveTestReport);
+
+	// Other events do not trigger the action
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::AssertionFail, "");
+	eventActionService.executePendingActions(0);
+	CHECK(ServiceTests::count() == 4);
+
+	// Nothing is executed while the event-action function is disabled
+	eventActionService.setEventActionFunctionStatus(false);
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	eventActionService.executePendingActions(0);
+	CHECK(ServiceTests::count() == 5);
+}
+
+/**
+ * Adds and enables a definition of a TC[17,1] action for the given event
+ */
+void addEnabledTestDefinition(uint16_t eventDefinitionID, uint16_t eventActionDefinitionID) {
+	Message message(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+	message.appendEnum16(0);
+	message.appendEnum16(eventDefinitionID);
+	message.appendEnum16(eventActionDefinitionID);
+	message.appendString(createTestRequest());
+	MessageParser::execute(message);
+
+	eventActionService.findEventActionDefinition(eventDefinitionID, eventActionDefinitionID)->enabled = true;
+}
+
+TEST_CASE("Event-actions are not queued twice", "[service][st19]") {
+	addEnabledTestDefinition(EventReportService::LowSeverityUnknownEvent, 1);
+	addEnabledTestDefinition(EventReportService::LowSeverityUnknownEvent, 2);
+
+	eventActionService.executePendingActions(1000);
+	for (int i = 0; i < 5; i++) {
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	}
+	CHECK(eventActionService.getQueueDepth() == 2);
+
+	CHECK(eventActionService.executePendingActions(1250) == 2);
+	CHECK(ServiceTests::countSentMessages(TestService::ServiceType, TestService::AreYouAliveTestReport) == 2);
+
+	auto& statistics = eventActionService.getActionQueueStatistics();
+	CHECK(statistics.executedActions == 2);
+	CHECK(statistics.coalescedActions == 8);
+	CHECK(statistics.droppedActions == 0);
+	CHECK(statistics.maxQueueDepth == 2);
+	CHECK(statistics.maxLatency == 250);
+	CHECK(statistics.totalLatency == 500);
+
+	// After execution, the actions can be queued again
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(eventActionService.getQueueDepth() == 2);
+}
+
+TEST_CASE("Event-action rate limiting", "[service][st19]") {
+	addEnabledTestDefinition(EventReportService::LowSeverityUnknownEvent, 1);
+	eventActionService.minimumEventInterval = 1000;
+
+	eventActionService.executePendingActions(5000);
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(eventActionService.executePendingActions(5500) == 1);
+
+	// Raised again within the interval
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(eventActionService.getQueueDepth() == 0);
+	CHECK(eventActionService.getActionQueueStatistics().rateLimitedEvents == 1);
+
+	CHECK(eventActionService.executePendingActions(6000) == 0);
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+	CHECK(eventActionService.getQueueDepth() == 1);
+	CHECK(eventActionService.executePendingActions(6000) == 1);
+}
+
+TEST_CASE("Full event-action queue", "[service][st19]") {
+	for (uint16_t event = 0; event < ECSSEventActionQueueSize + 1; event++) {
+		addEnabledTestDefinition(event, 1);
+		eventActionService.queueActions(event);
+	}
+	CHECK(eventActionService.getQueueDepth() == ECSSEventActionQueueSize);
+	CHECK(eventActionService.getActionQueueStatistics().droppedActions == 1);
+
+	// The queue is emptied in several calls
+	CHECK(eventActionService.executePendingActions(0, 20) == 20);
+	CHECK(eventActionService.executePendingActions(0, 20) == ECSSEventActionQueueSize - 20);
+	CHECK(eventActionService.getQueueDepth() == 0);
+}
+
+TEST_CASE("Queued event-actions of deleted and disabled definitions", "[service][st19]") {
+	addEnabledTestDefinition(EventReportService::LowSeverityUnknownEvent, 1);
+	addEnabledTestDefinition(EventReportService::LowSeverityUnknownEvent, 2);
+	Services.eventReport.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, "");
+
+	Message disableMessage(EventActionService::ServiceType, EventActionService::MessageType::DisableEventAction,
+	                       Message::TC, 0);
+	disableMessage.appendUint16(2);
+	for (uint16_t eventActionDefinitionID = 1; eventActionDefinitionID <= 2; eventActionDefinitionID++) {
+		disableMessage.appendEnum16(0);
+		disableMessage.appendEnum16(EventReportService::LowSeverityUnknownEvent);
+		disableMessage.appendEnum16(eventActionDefinitionID);
+	}
+	MessageParser::execute(disableMessage);
+
+	Message deleteMessage(EventActionService::ServiceType, EventActionService::MessageType::DeleteEventAction,
+	                      Message::TC, 0);
+	deleteMessage.appendUint16(1);
+	deleteMessage.appendEnum16(0);
+	deleteMessage.appendEnum16(EventReportService::LowSeverityUnknownEvent);
+	deleteMessage.appendEnum16(1);
+	MessageParser::execute(deleteMessage);
+
+	CHECK(eventActionService.executePendingActions(0) == 0);
+	CHECK(eventActionService.getQueueDepth() == 0);
+	CHECK(ServiceTests::countSentMessages(TestService::ServiceType, TestService::AreYouAliveTestReport) == 0);
 }
@@ -141,6 +141,38 @@ TEST_CASE("List of Disabled Events Report TM[5,8]", "[service][st05]") {
 	CHECK(report.readEnum16() == 6);
 }
 
+TEST_CASE("List of Disabled Events Report split across reports TM[5,8]", "[service][st05]") {
+	const uint16_t disabledEvents = EventReportService::MaxDisabledEventsPerReport + 10;
+	for (uint16_t firstEventID = 0; firstEventID < disabledEvents; firstEventID += 100) {
+		Message message(EventReportService::ServiceType,
+		                EventReportService::MessageType::DisableReportGenerationOfEvents, Message::TC, 1);
+		uint16_t count = std::min<uint16_t>(100, disabledEvents - firstEventID);
+		message.appendUint16(count);
+		for (uint16_t eventID = firstEventID; eventID < firstEventID + count; eventID++) {
+			message.appendEnum16(2 * eventID);
+		}
+		MessageParser::execute(message);
+	}
+
+	eventReportService.listOfDisabledEventsReport();
+	REQUIRE(ServiceTests::count() == 2);
+
+	uint16_t expectedEventID = 0;
+	for (uint16_t index = 0; index < 2; index++) {
+		Message report = ServiceTests::get(index);
+		CHECK(report.messageType == EventReportService::MessageType::DisabledListEventReport);
+		CHECK(report.dataSize <= ECSSMaxMessageSize);
+
+		uint16_t count = report.readHalfword();
+		CHECK(count == ((index == 0) ? EventReportService::MaxDisabledEventsPerReport : 10));
+		for (uint16_t i = 0; i < count; i++) {
+			CHECK(report.readEnum16() == expectedEventID);
+			expectedEventID += 2;
+		}
+	}
+	CHECK(expectedEventID == 2 * disabledEvents);
+}
+
 TEST_CASE("List of observables 6.5.6", "[service][st05]") {
 	EventReportService::Event eventID[] = {EventReportService::HighSeverityUnknownEvent};
 	Message message(EventReportService::ServiceType, EventReportService::MessageType::DisableReportGenerationOfEvents, Message::TC, 1);
@@ -166,3 +198,86 @@ TEST_CASE("List of observables 6.5.6", "[service][st05]") {
 	CHECK(eventReportService.lastMediumSeverityReportID == 5);
 	CHECK(eventReportService.lastHighSeverityReportID == 65535);
 }
+
+TEST_CASE("Event IDs beyond the predefined events", "[service][st05]") {
+	auto eventID = static_cast<EventReportService::Event>(EventReportService::numberOfEvents - 1);
+	eventReportService.informativeEventReport(eventID, "");
+	REQUIRE(ServiceTests::hasOneMessage());
+	CHECK(ServiceTests::get(0).readEnum16() == EventReportService::numberOfEvents - 1);
+
+	// Unknown events are not reported
+	eventReportService.informativeEventReport(static_cast<EventReportService::Event>(EventReportService::numberOfEvents),
+	                                          "");
+	CHECK(ServiceTests::count() == 1);
+}
+
+TEST_CASE("Event report throttling", "[service][st05]") {
+	const String<64> eventReportData = "HelloWorld";
+
+	eventReportService.processThrottledEvents(1000);
+	REQUIRE(eventReportService.setEventThrottle(EventReportService::LowSeverityUnknownEvent, 2, 500));
+	CHECK_FALSE(eventReportService.setEventThrottle(EventReportService::numberOfEvents, 2, 500));
+	CHECK_FALSE(eventReportService.setEventThrottle(EventReportService::AssertionFail, 2, 0));
+
+	for (int i = 0; i < 10; i++) {
+		eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	}
+	// Other events are not affected
+	eventReportService.lowSeverityAnomalyReport(EventReportService::AssertionFail, eventReportData);
+
+	CHECK(ServiceTests::count() == 3);
+	CHECK(eventReportService.lowSeverityEventCount == 11);
+	CHECK(eventReportService.lowSeverityReportCount == 3);
+
+	const auto* throttle = eventReportService.getEventThrottle(EventReportService::LowSeverityUnknownEvent);
+	REQUIRE(throttle != nullptr);
+	CHECK(throttle->tokens == 0);
+	CHECK(throttle->suppressedOccurrences == 8);
+	CHECK(throttle->totalSuppressedOccurrences == 8);
+
+	// No token has been refilled yet
+	eventReportService.processThrottledEvents(1400);
+	eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	CHECK(ServiceTests::count() == 3);
+
+	// The summary is generated as soon as a token is refilled
+	eventReportService.processThrottledEvents(1600);
+	REQUIRE(ServiceTests::count() == 4);
+	Message report = ServiceTests::get(3);
+	CHECK(report.messageType == EventReportService::MessageType::LowSeverityAnomalyReport);
+	CHECK(report.readEnum16() == EventReportService::SuppressedEventsSummary);
+	CHECK(report.readEnum16() == EventReportService::LowSeverityUnknownEvent);
+	CHECK(report.readUint32() == 9);
+	CHECK(report.readUint32() == 1000);
+	CHECK(report.readUint32() == 1400);
+	CHECK(throttle->suppressedOccurrences == 0);
+	CHECK(throttle->totalSuppressedOccurrences == 9);
+	CHECK(eventReportService.lowSeverityReportCount == 4);
+	CHECK(eventReportService.lastLowSeverityReportID == EventReportService::SuppressedEventsSummary);
+
+	// The bucket is refilled up to its size
+	eventReportService.processThrottledEvents(10000);
+	CHECK(throttle->tokens == 2);
+
+	// Without a throttle, every occurrence is reported
+	eventReportService.removeEventThrottle(EventReportService::LowSeverityUnknownEvent);
+	CHECK(eventReportService.getEventThrottle(EventReportService::LowSeverityUnknownEvent) == nullptr);
+	for (int i = 0; i < 5; i++) {
+		eventReportService.lowSeverityAnomalyReport(EventReportService::LowSeverityUnknownEvent, eventReportData);
+	}
+	CHECK(ServiceTests::count() == 9);
+}
+
+TEST_CASE("Event report throttling without aggregation", "[service][st05]") {
+	REQUIRE(eventReportService.setEventThrottle(EventReportService::HighSeverityUnknownEvent, 1, 100, false));
+
+	for (int i = 0; i < 4; i++) {
+		eventReportService.highSeverityAnomalyReport(EventReportService::HighSeverityUnknownEvent, "");
+	}
+	eventReportService.processThrottledEvents(1000);
+
+	CHECK(ServiceTests::count() == 1);
+	CHECK(eventReportService.highSeverityEventCount == 4);
+	CHECK(eventReportService.getEventThrottle(EventReportService::HighSeverityUnknownEvent)
+	          ->totalSuppressedOccurrences == 3);
+}
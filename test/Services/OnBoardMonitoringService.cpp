@@ -1,6 +1,7 @@
 #include <Message.hpp>
 #include <ServicePool.hpp>
 #include <Services/OnBoardMonitoringService.hpp>
+#include "Parameters/PlatformParameters.hpp"
 #include <catch2/catch_all.hpp>
 #include <etl/String.hpp>
 #include <etl/array.h>
@@ -34,6 +35,14 @@ void initialiseParameterMonitoringDefinitions() {
 	onBoardMonitoringService.addPMONDefinition(3, fixtures.monitoringDefinition4);
 }
 
+void setParameterMonitoringFunction(bool enabled) {
+	Message request(OnBoardMonitoringService::ServiceType,
+	                enabled ? OnBoardMonitoringService::MessageType::EnableParameterMonitoringFunction
+	                        : OnBoardMonitoringService::MessageType::DisableParameterMonitoringFunction,
+	                Message::TC, 0);
+	MessageParser::execute(request);
+}
+
 TEST_CASE("Enable Parameter Monitoring Definitions") {
 	SECTION("3 valid requests to enable Parameter Monitoring Definitions") {
 		initialiseParameterMonitoringDefinitions();
@@ -51,12 +60,12 @@ TEST_CASE("Enable Parameter Monitoring Definitions") {
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 0);
 
-		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled == true));
-		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoringEnabled == true));
-		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled == true));
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().repetitionCounter == 0);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().repetitionCounter == 0);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().repetitionCounter == 0);
+		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled == true));
+		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[1])->get().monitoringEnabled == true));
+		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled == true));
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().repetitionCounter == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1])->get().repetitionCounter == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().repetitionCounter == 0);
 
 		ServiceTests::reset();
 		Services.reset();
@@ -77,10 +86,10 @@ TEST_CASE("Enable Parameter Monitoring Definitions") {
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 1);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameterMonitoringDefinition) == 1);
-		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled == true));
-		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled == true));
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().repetitionCounter == 0);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().repetitionCounter == 0);
+		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled == true));
+		CHECK((onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled == true));
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().repetitionCounter == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().repetitionCounter == 0);
 
 		ServiceTests::reset();
 		Services.reset();
@@ -99,18 +108,18 @@ TEST_CASE("Disable Parameter Monitoring Definitions") {
 		request.appendEnum16(PMONIds[0]);
 		request.appendEnum16(PMONIds[1]);
 		request.appendEnum16(PMONIds[2]);
-		onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled = true;
-		onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoringEnabled = true;
-		onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[1])->get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled = true;
 
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 0);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().checkingStatus == PMONBase::Unchecked);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().checkingStatus == PMONBase::Unchecked);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[1])->get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().checkingStatus == PMONBase::Unchecked);
 
 		ServiceTests::reset();
 		Services.reset();
@@ -127,18 +136,18 @@ TEST_CASE("Disable Parameter Monitoring Definitions") {
 		request.appendEnum16(PMONIds[1]);
 		request.appendEnum16(PMONIds[2]);
 		request.appendEnum16(PMONIds[3]);
-		onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled = true;
-		onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled = true;
-		onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled = true;
+		onBoardMonitoringService.getPMONDefinition(PMONIds[3])->get().monitoringEnabled = true;
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 1);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameterMonitoringDefinition) == 1);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().monitoringEnabled == false);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().checkingStatus == PMONBase::Unchecked);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().checkingStatus == PMONBase::Unchecked);
-		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[3])->get().monitoringEnabled == false);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[0])->get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[2])->get().checkingStatus == PMONBase::Unchecked);
+		CHECK(onBoardMonitoringService.getPMONDefinition(PMONIds[3])->get().checkingStatus == PMONBase::Unchecked);
 
 		ServiceTests::reset();
 		Services.reset();
@@ -163,7 +172,7 @@ TEST_CASE("Change Maximum Transition Reporting Delay") {
 TEST_CASE("Delete all Parameter Monitoring Definitions") {
 	SECTION("Valid request to delete all Parameter Monitoring Definitions") {
 		initialiseParameterMonitoringDefinitions();
-		onBoardMonitoringService.parameterMonitoringFunctionStatus = false;
+		setParameterMonitoringFunction(false);
 		Message request =
 		    Message(OnBoardMonitoringService::ServiceType,
 		            OnBoardMonitoringService::MessageType::DeleteAllParameterMonitoringDefinitions, Message::TC, 0);
@@ -176,7 +185,7 @@ TEST_CASE("Delete all Parameter Monitoring Definitions") {
 	}
 	SECTION("Invalid request to delete all Parameter Monitoring Definitions") {
 		initialiseParameterMonitoringDefinitions();
-		onBoardMonitoringService.parameterMonitoringFunctionStatus = true;
+		setParameterMonitoringFunction(true);
 		Message request =
 		    Message(OnBoardMonitoringService::ServiceType,
 		            OnBoardMonitoringService::MessageType::DeleteAllParameterMonitoringDefinitions, Message::TC, 0);
@@ -191,3 +200,617 @@ TEST_CASE("Delete all Parameter Monitoring Definitions") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Parameter monitoring cycle") {
+	Services.reset();
+	setParameterMonitoringFunction(true);
+	auto countEvents = []() {
+		return ServiceTests::countSentMessages(EventReportService::ServiceType,
+		                                       EventReportService::LowSeverityAnomalyReport);
+	};
+
+	SECTION("Limit check with repetitions") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 2, 5, 3, 10, 4));
+		PMONBase& limitCheck = onBoardMonitoringService.getPMONDefinition(0)->get();
+		limitCheck.monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(7);
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::Unchecked);
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::WithinLimits);
+		CHECK(countEvents() == 0);
+
+		// A single violation is filtered out by the repetition number
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+		PlatformParameters::parameter2.setValue(7);
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::WithinLimits);
+
+		PlatformParameters::parameter2.setValue(2);
+		onBoardMonitoringService.checkParameters();
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::BelowLowLimit);
+		CHECK(limitCheck.checkTransitionList[0] == PMONBase::WithinLimits);
+		CHECK(limitCheck.checkTransitionList[1] == PMONBase::BelowLowLimit);
+
+		REQUIRE(countEvents() == 1);
+		Message report = ServiceTests::get(ServiceTests::count() - 2);
+		CHECK(report.serviceType == EventReportService::ServiceType);
+		CHECK(report.messageType == EventReportService::LowSeverityAnomalyReport);
+		CHECK(report.readEnum16() == 3);
+
+		// Staying out of limits does not raise the event again
+		onBoardMonitoringService.checkParameters();
+		CHECK(countEvents() == 1);
+	}
+
+	SECTION("Expected value check") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONExpectedValueCheck(1, 1, 4, 0b1100, 2));
+		PMONBase& expectedValueCheck = onBoardMonitoringService.getPMONDefinition(0)->get();
+		expectedValueCheck.monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(0b0111);
+		onBoardMonitoringService.checkParameters();
+		CHECK(expectedValueCheck.checkingStatus == PMONBase::ExpectedValue);
+
+		PlatformParameters::parameter2.setValue(0b1011);
+		onBoardMonitoringService.checkParameters();
+		CHECK(expectedValueCheck.checkingStatus == PMONBase::UnexpectedValue);
+		CHECK(countEvents() == 1);
+	}
+
+	SECTION("Delta check") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONDeltaCheck(1, 1, 2, -1, 1, 2, 4));
+		PMONBase& deltaCheck = onBoardMonitoringService.getPMONDefinition(0)->get();
+		deltaCheck.monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(10);
+		onBoardMonitoringService.checkParameters();
+		PlatformParameters::parameter2.setValue(11);
+		onBoardMonitoringService.checkParameters();
+		CHECK(deltaCheck.checkingStatus == PMONBase::Unchecked);
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+		CHECK(deltaCheck.checkingStatus == PMONBase::WithinThreshold);
+
+		PlatformParameters::parameter2.setValue(20);
+		onBoardMonitoringService.checkParameters();
+		PlatformParameters::parameter2.setValue(25);
+		onBoardMonitoringService.checkParameters();
+		CHECK(deltaCheck.checkingStatus == PMONBase::AboveHighThreshold);
+		CHECK(countEvents() == 1);
+	}
+
+	SECTION("Only changed parameters are checked again") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+		auto& limitCheck = static_cast<PMONLimitCheck&>(onBoardMonitoringService.getPMONDefinition(0)->get());
+		limitCheck.monitoringEnabled = true;
+
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::WithinLimits);
+		CHECK(limitCheck.isSettled());
+
+		// The result would change, but the settled definition is skipped while its parameter stays the same
+		limitCheck.highLimit = 6;
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::WithinLimits);
+
+		PlatformParameters::parameter2.setValue(8);
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::AboveHighLimit);
+	}
+
+	SECTION("Disabled definitions and monitoring function") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+		PMONBase& limitCheck = onBoardMonitoringService.getPMONDefinition(0)->get();
+
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::Unchecked);
+
+		limitCheck.monitoringEnabled = true;
+		setParameterMonitoringFunction(false);
+		CHECK_FALSE(onBoardMonitoringService.isParameterMonitoringFunctionEnabled());
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::Unchecked);
+
+		setParameterMonitoringFunction(true);
+		CHECK(onBoardMonitoringService.isParameterMonitoringFunctionEnabled());
+		onBoardMonitoringService.checkParameters();
+		CHECK(limitCheck.checkingStatus == PMONBase::WithinLimits);
+	}
+
+	SECTION("Enabling or disabling a definition restarts its checks") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONDeltaCheck(1, 2, 2, -1, 1, 2, 4));
+		auto& deltaCheck = static_cast<PMONDeltaCheck&>(onBoardMonitoringService.getPMONDefinition(0)->get());
+		deltaCheck.monitoringEnabled = true;
+
+		auto sampleDelta = [](uint16_t value) {
+			PlatformParameters::parameter2.setValue(value);
+			onBoardMonitoringService.checkParameters();
+		};
+		auto changeDefinitionStatus = [](OnBoardMonitoringService::MessageType messageType) {
+			Message request(OnBoardMonitoringService::ServiceType, messageType, Message::TC, 0);
+			request.appendUint16(1);
+			request.appendEnum16(0);
+			MessageParser::execute(request);
+		};
+
+		sampleDelta(10);
+		sampleDelta(20);
+		sampleDelta(30);
+		CHECK(deltaCheck.pendingCheckingStatus == PMONBase::AboveHighThreshold);
+		CHECK(deltaCheck.repetitionCounter == 1);
+		sampleDelta(40);
+		CHECK(deltaCheck.deltaCount == 1);
+
+		changeDefinitionStatus(OnBoardMonitoringService::MessageType::EnableParameterMonitoringDefinitions);
+		CHECK(deltaCheck.pendingCheckingStatus == PMONBase::Unchecked);
+		CHECK(deltaCheck.repetitionCounter == 0);
+		CHECK_FALSE(deltaCheck.hasPreviousValue);
+		CHECK(deltaCheck.deltaCount == 0);
+		CHECK(deltaCheck.deltaSum == 0);
+
+		// The violation seen before the definition was enabled again does not count towards the repetition number
+		sampleDelta(50);
+		sampleDelta(60);
+		sampleDelta(70);
+		CHECK(deltaCheck.checkingStatus == PMONBase::Unchecked);
+		CHECK(deltaCheck.repetitionCounter == 1);
+		sampleDelta(80);
+
+		changeDefinitionStatus(OnBoardMonitoringService::MessageType::DisableParameterMonitoringDefinitions);
+		CHECK(deltaCheck.checkingStatus == PMONBase::Unchecked);
+		CHECK(deltaCheck.pendingCheckingStatus == PMONBase::Unchecked);
+		CHECK(deltaCheck.repetitionCounter == 0);
+		CHECK_FALSE(deltaCheck.hasPreviousValue);
+		CHECK(deltaCheck.deltaCount == 0);
+	}
+
+	SECTION("Enabling the monitoring function restarts the checks") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONDeltaCheck(1, 1, 2, -1, 1, 2, 4));
+		auto& deltaCheck = static_cast<PMONDeltaCheck&>(onBoardMonitoringService.getPMONDefinition(0)->get());
+		deltaCheck.monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(10);
+		onBoardMonitoringService.checkParameters();
+		CHECK(deltaCheck.hasPreviousValue);
+
+		setParameterMonitoringFunction(false);
+		setParameterMonitoringFunction(true);
+		CHECK_FALSE(deltaCheck.hasPreviousValue);
+	}
+
+	PlatformParameters::parameter2.setValue(7);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Add Parameter Monitoring Definitions") {
+	SECTION("Valid definitions of every check type") {
+		Message request =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(3);
+
+		request.appendEnum16(0);
+		request.appendEnum16(1);
+		request.appendUint16(5);
+		request.appendEnum8(PMONBase::ExpectedValueCheck);
+		request.appendUint64(0xF0);
+		request.appendUint64(0x30);
+		request.appendEnum16(1);
+
+		request.appendEnum16(5);
+		request.appendEnum16(1);
+		request.appendUint16(2);
+		request.appendEnum8(PMONBase::LimitCheck);
+		request.appendDouble(-2.5);
+		request.appendEnum16(2);
+		request.appendDouble(8.5);
+		request.appendEnum16(3);
+
+		request.appendEnum16(3);
+		request.appendEnum16(2);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::DeltaCheck);
+		request.appendDouble(-1);
+		request.appendEnum16(4);
+		request.appendDouble(1);
+		request.appendEnum16(5);
+		request.appendUint16(6);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 3);
+
+		auto& expectedValueCheck =
+		    static_cast<PMONExpectedValueCheck&>(onBoardMonitoringService.getPMONDefinition(0)->get());
+		CHECK(expectedValueCheck.checkType == PMONBase::ExpectedValueCheck);
+		CHECK(expectedValueCheck.monitoredParameterId == 1);
+		CHECK(expectedValueCheck.repetitionNumber == 5);
+		CHECK(expectedValueCheck.mask == 0xF0);
+		CHECK(expectedValueCheck.expectedValue == 0x30);
+		CHECK(expectedValueCheck.unexpectedValueEvent == 1);
+		CHECK_FALSE(expectedValueCheck.monitoringEnabled);
+
+		auto& limitCheck = static_cast<PMONLimitCheck&>(onBoardMonitoringService.getPMONDefinition(5)->get());
+		CHECK(limitCheck.checkType == PMONBase::LimitCheck);
+		CHECK(limitCheck.lowLimit == -2.5);
+		CHECK(limitCheck.belowLowLimitEvent == 2);
+		CHECK(limitCheck.highLimit == 8.5);
+		CHECK(limitCheck.aboveHighLimitEvent == 3);
+
+		auto& deltaCheck = static_cast<PMONDeltaCheck&>(onBoardMonitoringService.getPMONDefinition(3)->get());
+		CHECK(deltaCheck.checkType == PMONBase::DeltaCheck);
+		CHECK(deltaCheck.monitoredParameterId == 2);
+		CHECK(deltaCheck.lowDeltaThreshold == -1);
+		CHECK(deltaCheck.highDeltaThreshold == 1);
+		CHECK(deltaCheck.numberOfConsecutiveDeltaChecks == 6);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Invalid definitions") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 1, 0, 1, 10, 2));
+
+		Message request =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(5);
+
+		// Existing PMON ID
+		request.appendEnum16(0);
+		request.appendEnum16(1);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::LimitCheck);
+		request.appendDouble(0);
+		request.appendEnum16(1);
+		request.appendDouble(5);
+		request.appendEnum16(2);
+
+		// Non-existing parameter
+		request.appendEnum16(1);
+		request.appendEnum16(1000);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::ExpectedValueCheck);
+		request.appendUint64(1);
+		request.appendUint64(1);
+		request.appendEnum16(1);
+
+		// High limit below low limit
+		request.appendEnum16(2);
+		request.appendEnum16(1);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::LimitCheck);
+		request.appendDouble(5);
+		request.appendEnum16(1);
+		request.appendDouble(4);
+		request.appendEnum16(2);
+
+		// High threshold below low threshold
+		request.appendEnum16(3);
+		request.appendEnum16(1);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::DeltaCheck);
+		request.appendDouble(1);
+		request.appendEnum16(1);
+		request.appendDouble(-1);
+		request.appendEnum16(2);
+		request.appendUint16(3);
+
+		// Unknown check type, which stops the processing of the request
+		request.appendEnum16(4);
+		request.appendEnum16(1);
+		request.appendUint16(1);
+		request.appendEnum8(7);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() == 5);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::AddAlreadyExistingParameter) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameter) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::HighLimitIsLowerThanLowLimit) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::HighThresholdIsLowerThanLowThreshold) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidParameterMonitoringCheckType) == 1);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 1);
+		CHECK(static_cast<PMONLimitCheck&>(onBoardMonitoringService.getPMONDefinition(0)->get()).highLimit == 10);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Full pool") {
+		for (uint16_t id = 0; id < ECSSMaxDeltaCheckDefinitions; id++) {
+			REQUIRE(onBoardMonitoringService.addPMONDefinition(id, PMONDeltaCheck(1, 1, 1, -1, 1, 1, 2)));
+		}
+		CHECK_FALSE(onBoardMonitoringService.addPMONDefinition(ECSSMaxDeltaCheckDefinitions,
+		                                                       PMONDeltaCheck(1, 1, 1, -1, 1, 1, 2)));
+
+		Message request =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(1);
+		request.appendEnum16(ECSSMaxDeltaCheckDefinitions);
+		request.appendEnum16(1);
+		request.appendUint16(1);
+		request.appendEnum8(PMONBase::DeltaCheck);
+		request.appendDouble(-1);
+		request.appendEnum16(1);
+		request.appendDouble(1);
+		request.appendEnum16(2);
+		request.appendUint16(1);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ParameterMonitoringListIsFull) == 1);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == ECSSMaxDeltaCheckDefinitions);
+
+		// A definition of another check type still fits
+		CHECK(onBoardMonitoringService.addPMONDefinition(ECSSMaxDeltaCheckDefinitions,
+		                                                 PMONLimitCheck(1, 1, 0, 1, 5, 2)));
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Parameter monitoring cycle with many definitions") {
+	Services.reset();
+	setParameterMonitoringFunction(true);
+
+	// Spans several evaluation batches, with disabled definitions in between
+	const uint16_t definitions = ECSSMaxLimitCheckDefinitions - 1;
+	for (uint16_t id = 0; id < definitions; id++) {
+		onBoardMonitoringService.addPMONDefinition(id, PMONLimitCheck(1, 1, id, 1, id + 0.5, 2));
+		onBoardMonitoringService.getPMONDefinition(id)->get().monitoringEnabled = (id % 3 != 0);
+	}
+	// A definition of a parameter that does not exist
+	onBoardMonitoringService.addPMONDefinition(definitions, PMONLimitCheck(1000, 1, 0, 1, 1, 2));
+	onBoardMonitoringService.getPMONDefinition(definitions)->get().monitoringEnabled = true;
+
+	PlatformParameters::parameter2.setValue(50);
+	onBoardMonitoringService.checkParameters();
+
+	for (uint16_t id = 0; id < definitions; id++) {
+		PMONBase& definition = onBoardMonitoringService.getPMONDefinition(id)->get();
+		if (id % 3 == 0) {
+			CHECK(definition.checkingStatus == PMONBase::Unchecked);
+		} else if (id < 50) {
+			CHECK(definition.checkingStatus == PMONBase::AboveHighLimit);
+		} else if (id == 50) {
+			CHECK(definition.checkingStatus == PMONBase::WithinLimits);
+		} else {
+			CHECK(definition.checkingStatus == PMONBase::BelowLowLimit);
+		}
+	}
+	CHECK(onBoardMonitoringService.getPMONDefinition(definitions)->get().checkingStatus == PMONBase::Invalid);
+	// All 42 enabled definitions but the one within its limits raise an event
+	CHECK(ServiceTests::countSentMessages(EventReportService::ServiceType,
+	                                      EventReportService::LowSeverityAnomalyReport) == 41);
+
+	PlatformParameters::parameter2.setValue(7);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Check transition reports") {
+	Services.reset();
+	setParameterMonitoringFunction(true);
+	auto countTransitionReports = []() {
+		return ServiceTests::countSentMessages(OnBoardMonitoringService::ServiceType,
+		                                       OnBoardMonitoringService::CheckTransitionReport);
+	};
+
+	SECTION("Report contents") {
+		onBoardMonitoringService.addPMONDefinition(4, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+		onBoardMonitoringService.getPMONDefinition(4)->get().monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+
+		REQUIRE(countTransitionReports() == 1);
+		Message report = ServiceTests::get(ServiceTests::count() - 1);
+		CHECK(report.messageType == OnBoardMonitoringService::CheckTransitionReport);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readEnum16() == 4);
+		CHECK(report.readEnum16() == 1);
+		CHECK(report.readEnum8() == PMONBase::LimitCheck);
+		CHECK(report.readDouble() == 10);
+		CHECK(report.readEnum8() == PMONBase::Unchecked);
+		CHECK(report.readEnum8() == PMONBase::AboveHighLimit);
+		report.readCustomCUCTimeStamp();
+		CHECK(report.dataSize == report.readPosition);
+		CHECK(onBoardMonitoringService.getPendingTransitionCount() == 0);
+	}
+
+	SECTION("Transitions are batched until the delay expires") {
+		onBoardMonitoringService.maximumTransitionReportingDelay = 2;
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+		onBoardMonitoringService.addPMONDefinition(1, PMONLimitCheck(1, 1, 0, 3, 20, 4));
+		onBoardMonitoringService.getPMONDefinition(0)->get().monitoringEnabled = true;
+
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getPendingTransitionCount() == 1);
+
+		onBoardMonitoringService.getPMONDefinition(1)->get().monitoringEnabled = true;
+		PlatformParameters::parameter2.setValue(7);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getPendingTransitionCount() == 3);
+		CHECK(countTransitionReports() == 0);
+
+		onBoardMonitoringService.checkParameters();
+		REQUIRE(countTransitionReports() == 1);
+		CHECK(onBoardMonitoringService.getPendingTransitionCount() == 0);
+		Message report = ServiceTests::get(ServiceTests::count() - 1);
+		CHECK(report.readUint16() == 3);
+
+		// No report is sent when there are no new transitions
+		onBoardMonitoringService.checkParameters();
+		onBoardMonitoringService.checkParameters();
+		onBoardMonitoringService.checkParameters();
+		CHECK(countTransitionReports() == 1);
+	}
+
+	SECTION("Transitions are reported when the queue is full") {
+		onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+		const uint16_t definitions = ECSSMaxLimitCheckDefinitions;
+		for (uint16_t id = 0; id < definitions; id++) {
+			onBoardMonitoringService.addPMONDefinition(id, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+			onBoardMonitoringService.getPMONDefinition(id)->get().monitoringEnabled = true;
+		}
+
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+
+		uint16_t reportedTransitions = 0;
+		for (uint64_t i = 0; i < ServiceTests::count(); i++) {
+			Message& message = ServiceTests::get(i);
+			if (message.serviceType == OnBoardMonitoringService::ServiceType) {
+				CHECK(message.dataSize <= ECSSMaxMessageSize);
+				reportedTransitions += message.readUint16();
+			}
+		}
+		CHECK(countTransitionReports() == definitions / OnBoardMonitoringService::MaxTransitionsPerReport);
+		CHECK(reportedTransitions + onBoardMonitoringService.getPendingTransitionCount() == definitions);
+
+		onBoardMonitoringService.checkTransitionReport();
+		CHECK(onBoardMonitoringService.getPendingTransitionCount() == 0);
+	}
+
+	PlatformParameters::parameter2.setValue(7);
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Report out-of-limits") {
+	Services.reset();
+	setParameterMonitoringFunction(true);
+	onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+
+	auto requestReport = []() {
+		Message request = Message(OnBoardMonitoringService::ServiceType,
+		                          OnBoardMonitoringService::MessageType::ReportOutOfLimits, Message::TC, 0);
+		MessageParser::execute(request);
+	};
+
+	SECTION("Definitions enter and leave the out-of-limits list") {
+		onBoardMonitoringService.addPMONDefinition(0, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+		onBoardMonitoringService.addPMONDefinition(1, PMONLimitCheck(1, 1, 0, 3, 8, 4));
+		onBoardMonitoringService.addPMONDefinition(2, PMONExpectedValueCheck(1, 1, 7, 0xFF, 2));
+		for (uint16_t id = 0; id < 3; id++) {
+			onBoardMonitoringService.getPMONDefinition(id)->get().monitoringEnabled = true;
+		}
+
+		PlatformParameters::parameter2.setValue(7);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 0);
+
+		PlatformParameters::parameter2.setValue(9);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 2);
+
+		// Moving from above to below the limits keeps a single entry, with the latest transition
+		PlatformParameters::parameter2.setValue(2);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 2);
+
+		uint64_t firstReport = ServiceTests::count();
+		requestReport();
+		REQUIRE(ServiceTests::count() == firstReport + 1);
+		Message report = ServiceTests::get(firstReport);
+		CHECK(report.messageType == OnBoardMonitoringService::OutOfLimitsReport);
+		REQUIRE(report.readUint16() == 2);
+
+		etl::array<uint16_t, 2> reportedIds = {};
+		for (auto& reportedId: reportedIds) {
+			reportedId = report.readEnum16();
+			CHECK(report.readEnum16() == 1);
+			if (reportedId == 0) {
+				CHECK(report.readEnum8() == PMONBase::LimitCheck);
+				CHECK(report.readDouble() == 5);
+				CHECK(report.readEnum8() == PMONBase::WithinLimits);
+				CHECK(report.readEnum8() == PMONBase::BelowLowLimit);
+			} else {
+				CHECK(report.readEnum8() == PMONBase::ExpectedValueCheck);
+				CHECK(report.readDouble() == 7);
+				CHECK(report.readEnum8() == PMONBase::ExpectedValue);
+				CHECK(report.readEnum8() == PMONBase::UnexpectedValue);
+			}
+			report.readCustomCUCTimeStamp();
+		}
+		std::sort(reportedIds.begin(), reportedIds.end());
+		CHECK(reportedIds == etl::array<uint16_t, 2>{0, 2});
+
+		// Back within limits, and disabled definitions, are removed from the list
+		PlatformParameters::parameter2.setValue(6);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 1);
+
+		Message disableRequest =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::DisableParameterMonitoringDefinitions, Message::TC, 0);
+		disableRequest.appendUint16(1);
+		disableRequest.appendEnum16(2);
+		MessageParser::execute(disableRequest);
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 0);
+
+		firstReport = ServiceTests::count();
+		requestReport();
+		REQUIRE(ServiceTests::count() == firstReport + 1);
+		CHECK(ServiceTests::get(firstReport).readUint16() == 0);
+	}
+
+	SECTION("Out-of-limits reports are paginated") {
+		const uint16_t definitions = ECSSMaxLimitCheckDefinitions;
+		for (uint16_t id = 0; id < definitions; id++) {
+			onBoardMonitoringService.addPMONDefinition(id, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+			onBoardMonitoringService.getPMONDefinition(id)->get().monitoringEnabled = true;
+		}
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == definitions);
+
+		uint64_t firstReport = ServiceTests::count();
+		requestReport();
+		const uint16_t expectedReports = (definitions + OnBoardMonitoringService::MaxTransitionsPerReport - 1) /
+		                                 OnBoardMonitoringService::MaxTransitionsPerReport;
+		CHECK(ServiceTests::count() == firstReport + expectedReports);
+
+		uint16_t reportedDefinitions = 0;
+		for (uint64_t i = firstReport; i < ServiceTests::count(); i++) {
+			Message& report = ServiceTests::get(i);
+			CHECK(report.messageType == OnBoardMonitoringService::OutOfLimitsReport);
+			CHECK(report.dataSize <= ECSSMaxMessageSize);
+			reportedDefinitions += report.readUint16();
+		}
+		CHECK(reportedDefinitions == definitions);
+	}
+
+	SECTION("Full out-of-limits list") {
+		const uint16_t definitions = ECSSMaxOutOfLimitsDefinitions + 1;
+		for (uint16_t id = 0; id < definitions; id++) {
+			if (id < ECSSMaxLimitCheckDefinitions) {
+				onBoardMonitoringService.addPMONDefinition(id, PMONLimitCheck(1, 1, 5, 3, 10, 4));
+			} else {
+				onBoardMonitoringService.addPMONDefinition(id, PMONExpectedValueCheck(1, 1, 7, 0xFF, 2));
+			}
+			onBoardMonitoringService.getPMONDefinition(id)->get().monitoringEnabled = true;
+		}
+		PlatformParameters::parameter2.setValue(12);
+		onBoardMonitoringService.checkParameters();
+
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == ECSSMaxOutOfLimitsDefinitions);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MapFull) == 1);
+
+		// The definitions that left the list make room for others
+		PlatformParameters::parameter2.setValue(7);
+		onBoardMonitoringService.checkParameters();
+		CHECK(onBoardMonitoringService.getOutOfLimitsCount() == 0);
+	}
+
+	PlatformParameters::parameter2.setValue(7);
+	ServiceTests::reset();
+	Services.reset();
+}
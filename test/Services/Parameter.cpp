@@ -70,3 +70,18 @@ TEST_CASE("Get value as double") {
 		CHECK(parameter4.getValueAsDouble() == Catch::Approx(14.237).epsilon(0.001));
 	}
 }
+
+TEST_CASE("Get value as uint64") {
+	SECTION("Unsigned values keep all of their bits") {
+		auto parameter = Parameter<uint64_t>(0xFFFFFFFFFFFFFFF1);
+		CHECK(parameter.getValueAsUint64() == 0xFFFFFFFFFFFFFFF1);
+	}
+	SECTION("Signed values are sign-extended") {
+		auto parameter = Parameter<int8_t>(-2);
+		CHECK(parameter.getValueAsUint64() == 0xFFFFFFFFFFFFFFFE);
+	}
+	SECTION("Floating-point values have no integer value") {
+		auto parameter = Parameter<float>(3.0F);
+		CHECK_FALSE(parameter.getValueAsUint64());
+	}
+}
@@ -212,3 +212,137 @@ TEST_CASE("Wrong Messages") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Consistent parameter reads") {
+	auto& parameterManagement = Services.parameterManagement;
+	uint32_t lockShards = parameterManagement.lockShardsOf(1) | parameterManagement.lockShardsOf(2);
+	int runs = 0;
+	uint32_t value2 = 0;
+	uint32_t value3 = 0;
+
+	SECTION("Concurrent update of a read parameter") {
+		bool consistent = parameterManagement.readConsistently(lockShards, [&]() {
+			runs++;
+			value2 = PlatformParameters::parameter2.getValue();
+
+			if (runs == 1) {
+				// A producer updates both parameters while the first read is in progress
+				PlatformParameters::parameter2.setValue(8);
+				PlatformParameters::parameter3.setValue(11);
+			}
+
+			value3 = PlatformParameters::parameter3.getValue();
+		});
+
+		CHECK(consistent);
+		CHECK(runs == 2);
+		CHECK(value2 == 8);
+		CHECK(value3 == 11);
+	}
+
+	SECTION("Concurrent update of a parameter in another shard") {
+		REQUIRE((parameterManagement.lockShardsOf(4) & lockShards) == 0);
+
+		bool consistent = parameterManagement.readConsistently(lockShards, [&]() {
+			runs++;
+			PlatformParameters::parameter5.setValue(static_cast<uint8_t>(runs));
+		});
+
+		CHECK(consistent);
+		CHECK(runs == 1);
+		PlatformParameters::parameter5.setValue(11);
+	}
+
+	SECTION("Steady producer") {
+		bool consistent = parameterManagement.readConsistently(lockShards, [&]() {
+			runs++;
+			PlatformParameters::parameter2.setValue(static_cast<uint16_t>(runs));
+		});
+
+		CHECK_FALSE(consistent);
+		CHECK(runs == SeqLock::DefaultReadAttempts);
+	}
+
+	SECTION("Report while a producer is updating a parameter") {
+		Message request = Message(ParameterService::ServiceType, ParameterService::MessageType::ReportParameterValues,
+		                          Message::TC, 1);
+		request.appendUint16(1);
+		request.appendUint16(1);
+
+		// The update is never finished, so no read of the parameter is consistent
+		SeqLock& lock = PlatformParameters::parameter2.valueLock();
+		lock.beginWrite();
+		MessageParser::execute(request);
+		lock.endWrite();
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InconsistentParameterRead) == 1);
+		REQUIRE(ServiceTests::count() == 1);
+
+		Message report = ServiceTests::get(0);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readUint16() == 7);
+
+		ServiceTests::reset();
+	}
+
+	resetParameterValues();
+}
+
+static etl::vector<uint16_t, ECSSParameterCount> notifiedParameters;
+
+static void recordNotification(uint16_t parameterId) {
+	notifiedParameters.push_back(parameterId);
+}
+
+TEST_CASE("Parameter change notifications") {
+	notifiedParameters.clear();
+	Services.reset();
+
+	SECTION("Draining changed parameters") {
+		PlatformParameters::parameter3.setValue(20);
+		PlatformParameters::parameter1.setValue(4);
+		PlatformParameters::parameter1.setValue(5);
+		PlatformParameters::parameter2.setValue(7); // Same as the current value
+
+		etl::vector<uint16_t, ECSSParameterCount> changed;
+		Services.parameterManagement.drainChangedParameters(ParameterChangeNotifier::Statistics,
+		                                                    [&](uint16_t parameterId) { changed.push_back(parameterId); });
+		REQUIRE(changed.size() == 2);
+		CHECK(changed[0] == 0);
+		CHECK(changed[1] == 2);
+
+		changed.clear();
+		Services.parameterManagement.drainChangedParameters(ParameterChangeNotifier::Statistics,
+		                                                    [&](uint16_t parameterId) { changed.push_back(parameterId); });
+		CHECK(changed.empty());
+
+		// Every consumer keeps its own changes
+		Services.parameterManagement.drainChangedParameters(ParameterChangeNotifier::Monitoring,
+		                                                    [&](uint16_t parameterId) { changed.push_back(parameterId); });
+		CHECK(changed.size() == 2);
+	}
+
+	SECTION("Subscriptions") {
+		CHECK(Services.parameterManagement.subscribeToParameter(1, recordNotification));
+		CHECK_FALSE(Services.parameterManagement.subscribeToParameter(60000, recordNotification));
+
+		PlatformParameters::parameter1.setValue(9);
+		PlatformParameters::parameter2.setValue(8);
+		PlatformParameters::parameter2.setValue(8);
+		PlatformParameters::parameter2.setValue(9);
+
+		REQUIRE(notifiedParameters.size() == 2);
+		CHECK(notifiedParameters[0] == 1);
+		CHECK(notifiedParameters[1] == 1);
+
+		for (uint8_t subscriber = 1; subscriber < ECSSMaxParameterSubscribers; subscriber++) {
+			CHECK(Services.parameterManagement.subscribeToParameter(1, recordNotification));
+		}
+		CHECK_FALSE(Services.parameterManagement.subscribeToParameter(1, recordNotification));
+	}
+
+	resetParameterValues();
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include "ECSS_Definitions.hpp"
 #include "Message.hpp"
+#include "Parameters/PlatformParameters.hpp"
 #include "ServiceTests.hpp"
 #include "catch2/catch_all.hpp"
 
@@ -23,12 +24,33 @@ void initializeStatistics(uint16_t interval1, uint16_t interval2) {
 	for (int i = 0; i < numOfSamples; i++) { // Values of stat-2: [ 3, 5, 7, 9, 11, 13 ]
 		stat2.updateStatistics(i * 2 + 3);
 	}
-	Services.parameterStatistics.statisticsMap.insert({id1, stat1});
-	Services.parameterStatistics.statisticsMap.insert({id2, stat2});
+	Services.parameterStatistics.statistics.insert(id1, stat1);
+	Services.parameterStatistics.statistics.insert(id2, stat2);
+}
+
+/**
+ * @return A copy of the statistic of a parameter, which must have a statistics definition
+ */
+Statistic getStatistic(uint16_t parameterId) {
+	auto& statistics = Services.parameterStatistics.statistics;
+	return statistics.get(*statistics.findIndex(parameterId));
+}
+
+/**
+ * Changes the mean of the statistic of a parameter, adding a statistics definition for it if needed
+ */
+void setStatisticMean(uint16_t parameterId, double mean) {
+	auto& statistics = Services.parameterStatistics.statistics;
+	statistics.insert(parameterId);
+	uint16_t index = *statistics.findIndex(parameterId);
+
+	Statistic statistic = statistics.get(index);
+	statistic.mean = mean;
+	statistics.set(index, statistic);
 }
 
 void resetSystem() {
-	Services.parameterStatistics.statisticsMap.clear();
+	Services.parameterStatistics.statistics.clear();
 }
 
 TEST_CASE("Reporting of statistics") {
@@ -66,8 +88,8 @@ TEST_CASE("Reporting of statistics") {
 		CHECK(report.readFloat() == 3);                   // mean
 		CHECK(static_cast<int>(report.readFloat()) == 1); // stddev
 
-		CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(not getStatistic(5).statisticsAreInitialized());
+		CHECK(not getStatistic(7).statisticsAreInitialized());
 	}
 
 	SECTION("Report statistics, with auto statistics reset enabled") {
@@ -76,25 +98,25 @@ TEST_CASE("Reporting of statistics") {
 		Services.parameterStatistics.hasAutomaticStatisticsReset = true;
 		MessageParser::execute(request);
 
-		CHECK(Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(getStatistic(5).statisticsAreInitialized());
+		CHECK(getStatistic(7).statisticsAreInitialized());
 	}
 
 	SECTION("Report statistics, with auto statistics reset disabled, but reset is given by TC") {
 		Message request = Message(ParameterStatisticsService::ServiceType,
 		                          ParameterStatisticsService::MessageType::ReportParameterStatistics, Message::TC, 1);
 		request.appendBoolean(true);
-		Services.parameterStatistics.statisticsMap[5].mean = 5;
-		Services.parameterStatistics.statisticsMap[7].mean = 3;
+		setStatisticMean(5, 5);
+		setStatisticMean(7, 3);
 		Services.parameterStatistics.hasAutomaticStatisticsReset = false;
 
-		CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(not getStatistic(5).statisticsAreInitialized());
+		CHECK(not getStatistic(7).statisticsAreInitialized());
 
 		MessageParser::execute(request);
 
-		CHECK(Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(getStatistic(5).statisticsAreInitialized());
+		CHECK(getStatistic(7).statisticsAreInitialized());
 
 		resetSystem();
 		ServiceTests::reset();
@@ -108,13 +130,13 @@ TEST_CASE("Resetting the parameter statistics") {
 		Message request = Message(ParameterStatisticsService::ServiceType,
 		                          ParameterStatisticsService::MessageType::ResetParameterStatistics, Message::TC, 1);
 
-		CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(not getStatistic(5).statisticsAreInitialized());
+		CHECK(not getStatistic(7).statisticsAreInitialized());
 
 		MessageParser::execute(request);
 
-		CHECK(Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(getStatistic(5).statisticsAreInitialized());
+		CHECK(getStatistic(7).statisticsAreInitialized());
 
 		resetSystem();
 		ServiceTests::reset();
@@ -124,13 +146,13 @@ TEST_CASE("Resetting the parameter statistics") {
 	SECTION("Reset without TC") {
 		initializeStatistics(6, 7);
 
-		CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(not getStatistic(5).statisticsAreInitialized());
+		CHECK(not getStatistic(7).statisticsAreInitialized());
 
 		Services.parameterStatistics.resetParameterStatistics();
 
-		CHECK(Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
-		CHECK(Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
+		CHECK(getStatistic(5).statisticsAreInitialized());
+		CHECK(getStatistic(7).statisticsAreInitialized());
 
 		resetSystem();
 		ServiceTests::reset();
@@ -197,7 +219,7 @@ TEST_CASE("Add/Update statistics definitions") {
 		initializeStatistics(7, 6);
 		Statistic newStatistic;
 		newStatistic.setSelfSamplingInterval(0);
-		Services.parameterStatistics.statisticsMap.insert({0, newStatistic});
+		Services.parameterStatistics.statistics.insert(0, newStatistic);
 
 		Message request =
 		    Message(ParameterStatisticsService::ServiceType,
@@ -210,13 +232,13 @@ TEST_CASE("Add/Update statistics definitions") {
 		request.appendUint16(paramId1);
 		request.appendUint16(interval1);
 
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 3);
+		CHECK(Services.parameterStatistics.statistics.size() == 3);
 
 		MessageParser::execute(request);
 
 		REQUIRE(ServiceTests::count() == 0);
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 3);
-		CHECK(Services.parameterStatistics.statisticsMap[0].selfSamplingInterval == 14);
+		CHECK(Services.parameterStatistics.statistics.size() == 3);
+		CHECK(getStatistic(0).selfSamplingInterval == 14);
 
 		resetSystem();
 		ServiceTests::reset();
@@ -236,13 +258,13 @@ TEST_CASE("Add/Update statistics definitions") {
 		request.appendUint16(paramId1);
 		request.appendUint16(interval1);
 
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 2);
+		CHECK(Services.parameterStatistics.statistics.size() == 2);
 
 		MessageParser::execute(request);
 
 		REQUIRE(ServiceTests::count() == 0);
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 3);
-		CHECK(Services.parameterStatistics.statisticsMap[1].selfSamplingInterval == 32);
+		CHECK(Services.parameterStatistics.statistics.size() == 3);
+		CHECK(getStatistic(1).selfSamplingInterval == 32);
 
 		resetSystem();
 		ServiceTests::reset();
@@ -253,7 +275,7 @@ TEST_CASE("Add/Update statistics definitions") {
 		initializeStatistics(7, 6);
 		Statistic newStatistic;
 		newStatistic.setSelfSamplingInterval(0);
-		Services.parameterStatistics.statisticsMap.insert({0, newStatistic});
+		Services.parameterStatistics.statistics.insert(0, newStatistic);
 
 		Message request =
 		    Message(ParameterStatisticsService::ServiceType,
@@ -288,17 +310,17 @@ TEST_CASE("Add/Update statistics definitions") {
 		request.appendUint16(paramId6);
 		request.appendUint16(interval6);
 
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 3);
+		CHECK(Services.parameterStatistics.statistics.size() == 3);
 
 		MessageParser::execute(request);
 
 		REQUIRE(ServiceTests::count() == 4);
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 4);
+		CHECK(Services.parameterStatistics.statistics.size() == 4);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidSamplingRateError) == 1);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::SetNonExistingParameter) == 2);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MaxStatisticDefinitionsReached) == 1);
-		CHECK(Services.parameterStatistics.statisticsMap[0].selfSamplingInterval == 14);
-		CHECK(Services.parameterStatistics.statisticsMap[1].selfSamplingInterval == 32);
+		CHECK(getStatistic(0).selfSamplingInterval == 14);
+		CHECK(getStatistic(1).selfSamplingInterval == 32);
 
 		resetSystem();
 		ServiceTests::reset();
@@ -311,14 +333,14 @@ TEST_CASE("Delete statistics definitions") {
 		Statistic stat1;
 		Statistic stat2;
 		Statistic stat3;
-		Services.parameterStatistics.statisticsMap.insert({0, stat1});
-		Services.parameterStatistics.statisticsMap.insert({1, stat2});
-		Services.parameterStatistics.statisticsMap.insert({2, stat3});
+		Services.parameterStatistics.statistics.insert(0, stat1);
+		Services.parameterStatistics.statistics.insert(1, stat2);
+		Services.parameterStatistics.statistics.insert(2, stat3);
 
-		REQUIRE(Services.parameterStatistics.statisticsMap.size() == 3);
-		REQUIRE(Services.parameterStatistics.statisticsMap.find(0) != Services.parameterStatistics.statisticsMap.end());
-		REQUIRE(Services.parameterStatistics.statisticsMap.find(1) != Services.parameterStatistics.statisticsMap.end());
-		REQUIRE(Services.parameterStatistics.statisticsMap.find(2) != Services.parameterStatistics.statisticsMap.end());
+		REQUIRE(Services.parameterStatistics.statistics.size() == 3);
+		REQUIRE(Services.parameterStatistics.statistics.contains(0));
+		REQUIRE(Services.parameterStatistics.statistics.contains(1));
+		REQUIRE(Services.parameterStatistics.statistics.contains(2));
 
 		Message request =
 		    Message(ParameterStatisticsService::ServiceType,
@@ -335,7 +357,7 @@ TEST_CASE("Delete statistics definitions") {
 
 		CHECK(Services.parameterStatistics.periodicStatisticsReportingStatus == true);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameter) == 1);
-		CHECK(Services.parameterStatistics.statisticsMap.size() == 2);
+		CHECK(Services.parameterStatistics.statistics.size() == 2);
 	}
 
 	SECTION("Delete all definitions") {
@@ -349,7 +371,7 @@ TEST_CASE("Delete statistics definitions") {
 
 		CHECK(Services.parameterStatistics.periodicStatisticsReportingStatus == false);
 		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameter) == 1);
-		CHECK(Services.parameterStatistics.statisticsMap.empty());
+		CHECK(Services.parameterStatistics.statistics.empty());
 
 		resetSystem();
 		ServiceTests::reset();
@@ -360,9 +382,9 @@ TEST_CASE("Delete statistics definitions") {
 TEST_CASE("Parameter statistics definition report") {
 	SECTION("Check if the stored report is valid") {
 		initializeStatistics(0, 12);
-		REQUIRE(Services.parameterStatistics.statisticsMap.size() == 2);
-		REQUIRE(Services.parameterStatistics.statisticsMap.find(7) != Services.parameterStatistics.statisticsMap.end());
-		REQUIRE(Services.parameterStatistics.statisticsMap.find(5) != Services.parameterStatistics.statisticsMap.end());
+		REQUIRE(Services.parameterStatistics.statistics.size() == 2);
+		REQUIRE(Services.parameterStatistics.statistics.contains(7));
+		REQUIRE(Services.parameterStatistics.statistics.contains(5));
 
 		Message request =
 		    Message(ParameterStatisticsService::ServiceType,
@@ -384,3 +406,170 @@ TEST_CASE("Parameter statistics definition report") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Updating the statistics of changed parameters") {
+	Services.reset();
+	Services.parameterStatistics.statistics.insert(1, Statistic());
+
+	PlatformParameters::parameter1.setValue(6);
+	PlatformParameters::parameter2.setValue(12);
+	Services.parameterStatistics.updateChangedStatistics();
+
+	CHECK(getStatistic(1).sampleCounter == 1);
+	CHECK(getStatistic(1).max == Catch::Approx(12));
+
+	// Nothing changed, so no sample is added
+	Services.parameterStatistics.updateChangedStatistics();
+	CHECK(getStatistic(1).sampleCounter == 1);
+
+	PlatformParameters::parameter2.setValue(4);
+	Services.parameterStatistics.updateChangedStatistics();
+	CHECK(getStatistic(1).sampleCounter == 2);
+	CHECK(getStatistic(1).min == Catch::Approx(4));
+	CHECK(getStatistic(1).mean == Catch::Approx(8));
+
+	// Statistics with a self-sampling interval are only sampled by sampleDueStatistics()
+	Statistic selfSampledStatistic;
+	selfSampledStatistic.selfSamplingInterval = 10;
+	Services.parameterStatistics.statistics.insert(0, selfSampledStatistic);
+	PlatformParameters::parameter1.setValue(5);
+	Services.parameterStatistics.updateChangedStatistics();
+	CHECK(getStatistic(0).sampleCounter == 0);
+
+	// Change-driven samples are stamped with the time they are taken
+	TimeGetter::setClockSource(SimulatedClock::now);
+	SimulatedClock::set(0);
+	REQUIRE(Services.parameterStatistics.enableWindowedStatistics(1, 15));
+	PlatformParameters::parameter2.setValue(2);
+	Services.parameterStatistics.updateChangedStatistics();
+	SimulatedClock::advance(20 * TimeGetter::NanosecondsPerMillisecond);
+	PlatformParameters::parameter2.setValue(5);
+	Services.parameterStatistics.updateChangedStatistics();
+
+	auto windowedStatistic = Services.parameterStatistics.getWindowedStatistic(1);
+	REQUIRE(windowedStatistic);
+	CHECK(windowedStatistic->get().size() == 1);
+	CHECK(windowedStatistic->get().getMax() == 5);
+	TimeGetter::setClockSource(nullptr);
+
+	PlatformParameters::parameter1.setValue(3);
+	PlatformParameters::parameter2.setValue(7);
+	resetSystem();
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Self-sampling of statistics") {
+	Services.reset();
+	ParameterStatisticsService& service = Services.parameterStatistics;
+
+	Message request(ParameterStatisticsService::ServiceType,
+	                ParameterStatisticsService::MessageType::AddOrUpdateParameterStatisticsDefinitions, Message::TC, 1);
+	request.appendUint16(2);
+	request.appendUint16(0);
+	request.appendUint16(10);
+	request.appendUint16(1);
+	request.appendUint16(25);
+	MessageParser::execute(request);
+	REQUIRE(service.statistics.size() == 2);
+
+	SECTION("Each parameter is sampled at its own interval") {
+		CHECK(service.sampleDueStatistics(5) == 5);
+		CHECK(getStatistic(0).sampleCounter == 0);
+
+		CHECK(service.sampleDueStatistics(10) == 10);
+		CHECK(getStatistic(0).sampleCounter == 1);
+		CHECK(getStatistic(1).sampleCounter == 0);
+
+		PlatformParameters::parameter2.setValue(9);
+		CHECK(service.sampleDueStatistics(25) == 5);
+		CHECK(getStatistic(0).sampleCounter == 2);
+		CHECK(getStatistic(1).sampleCounter == 1);
+		CHECK(getStatistic(1).mean == Catch::Approx(9));
+
+		// Missed periods are not sampled in a burst
+		CHECK(service.sampleDueStatistics(100) == 10);
+		CHECK(getStatistic(0).sampleCounter == 3);
+		CHECK(getStatistic(1).sampleCounter == 2);
+	}
+
+	SECTION("Windowed statistics") {
+		CHECK_FALSE(service.enableWindowedStatistics(2, 0));
+		CHECK(service.enableWindowedStatistics(0, 15));
+
+		TimeGetter::setClockSource(SimulatedClock::now);
+		SimulatedClock::set(0);
+		constexpr uint64_t Millisecond = TimeGetter::NanosecondsPerMillisecond;
+
+		SimulatedClock::advance(10 * Millisecond);
+		PlatformParameters::parameter1.setValue(4);
+		service.sampleDueStatistics(10);
+		SimulatedClock::advance(10 * Millisecond);
+		PlatformParameters::parameter1.setValue(8);
+		service.sampleDueStatistics(20);
+		SimulatedClock::advance(10 * Millisecond);
+		PlatformParameters::parameter1.setValue(6);
+		service.sampleDueStatistics(30);
+
+		CHECK_FALSE(service.getWindowedStatistic(1));
+		auto windowedStatistic = service.getWindowedStatistic(0);
+		REQUIRE(windowedStatistic);
+		CHECK(windowedStatistic->get().size() == 2);
+		CHECK(windowedStatistic->get().getMax() == 8);
+		CHECK(windowedStatistic->get().getMin() == 6);
+		CHECK(getStatistic(0).sampleCounter == 3);
+		CHECK(getStatistic(0).min == 4);
+
+		// Samples also expire when the window is read without new samples
+		SimulatedClock::advance(10 * Millisecond);
+		CHECK(service.getWindowedStatistic(0)->get().size() == 1);
+		SimulatedClock::advance(10 * Millisecond);
+		CHECK(service.getWindowedStatistic(0)->get().size() == 0);
+
+		service.disableWindowedStatistics(0);
+		CHECK_FALSE(service.getWindowedStatistic(0));
+		PlatformParameters::parameter1.setValue(3);
+		TimeGetter::setClockSource(nullptr);
+	}
+
+	SECTION("Deleted definitions are not sampled") {
+		Message deleteRequest(ParameterStatisticsService::ServiceType,
+		                      ParameterStatisticsService::MessageType::DeleteParameterStatisticsDefinitions,
+		                      Message::TC, 1);
+		deleteRequest.appendUint16(1);
+		deleteRequest.appendUint16(0);
+		MessageParser::execute(deleteRequest);
+
+		CHECK(service.sampleDueStatistics(10) == 15);
+		CHECK(service.sampleDueStatistics(25) == 25);
+		CHECK(getStatistic(1).sampleCounter == 1);
+	}
+
+	SECTION("Periodic reporting") {
+		Message enableRequest(ParameterStatisticsService::ServiceType,
+		                      ParameterStatisticsService::MessageType::EnablePeriodicParameterReporting, Message::TC,
+		                      1);
+		enableRequest.appendUint16(20);
+		MessageParser::execute(enableRequest);
+
+		CHECK(service.sampleDueStatistics(10) == 10);
+		CHECK(ServiceTests::count() == 0);
+
+		CHECK(service.sampleDueStatistics(20) == 5);
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == ParameterStatisticsService::MessageType::ParameterStatisticsReport);
+		report.skipBytes(16); // Evaluation start and stop times
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readUint16() == 0);
+		CHECK(report.readUint16() == 2);
+
+		CHECK(service.sampleDueStatistics(40) == 10);
+		CHECK(ServiceTests::count() == 2);
+	}
+
+	PlatformParameters::parameter2.setValue(7);
+	resetSystem();
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -3,6 +3,7 @@
 #include "Message.hpp"
 #include "ServiceTests.hpp"
 #include "Services/RealTimeForwardingControlService.hpp"
+#include "Services/TestService.hpp"
 #include "catch2/catch_all.hpp"
 
 RealTimeForwardingControlService& realTimeForwarding = Services.realTimeForwarding;
@@ -181,7 +182,7 @@ void validInvalidAllReportsOfApp(Message& request) {
 }
 
 void resetAppProcessConfiguration() {
-	realTimeForwarding.applicationProcessConfiguration.definitions.clear();
+	realTimeForwarding.applicationProcessConfiguration.clear();
 	REQUIRE(realTimeForwarding.applicationProcessConfiguration.definitions.empty());
 }
 
@@ -551,3 +552,459 @@ TEST_CASE("Add report types to the Application Process Configuration") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Forwarding filter of the Application Process Configuration") {
+	Services.reset();
+	Message request(RealTimeForwardingControlService::ServiceType,
+	                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration, Message::TC,
+	                1);
+
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+	validReportTypes(request);
+	MessageParser::execute(request);
+
+	auto& configuration = realTimeForwarding.applicationProcessConfiguration;
+	for (uint8_t j = 0; j < 2; j++) {
+		uint8_t* messages = (j == 0) ? messages1 : messages2;
+		for (uint8_t k = 0; k < 2; k++) {
+			CHECK(configuration.isReportTypeForwarded(applicationID, services[j], messages[k]));
+			CHECK(not configuration.isReportTypeForwarded(applicationID + 1, services[j], messages[k]));
+		}
+	}
+	CHECK(not configuration.isReportTypeForwarded(applicationID, HousekeepingService::ServiceType,
+	                                              HousekeepingService::MessageType::HousekeepingParametersReport));
+	CHECK(not configuration.isReportTypeForwarded(applicationID, EventReportService::ServiceType,
+	                                              EventReportService::MessageType::HighSeverityAnomalyReport));
+
+	configuration.clear();
+	CHECK(not configuration.isReportTypeForwarded(applicationID, services[0], messages1[0]));
+}
+
+TEST_CASE("Reports of controlled application processes filtered on output") {
+	ServiceTests::reset();
+	uint8_t applicationID = 0; // The services create their reports with this application process ID
+	Message areYouAlive(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 1);
+
+	SECTION("Application process not controlled") {
+		MessageParser::execute(areYouAlive);
+		CHECK(ServiceTests::count() == 1);
+	}
+
+	SECTION("Report type not in the configuration") {
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+		MessageParser::execute(areYouAlive);
+		CHECK(ServiceTests::count() == 0);
+
+		Message report(TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport, Message::TM,
+		               applicationID + 1);
+		CHECK(realTimeForwarding.isReportForwarded(report));
+	}
+
+	SECTION("Report type in the configuration") {
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+		                Message::TC, 1);
+		request.appendUint8(1);
+		request.appendUint8(applicationID);
+		request.appendUint8(1);
+		request.appendUint8(TestService::ServiceType);
+		request.appendUint8(1);
+		request.appendUint8(TestService::MessageType::AreYouAliveTestReport);
+		MessageParser::execute(request);
+
+		MessageParser::execute(areYouAlive);
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).messageType == TestService::MessageType::AreYouAliveTestReport);
+
+		Message onBoardConnection(TestService::ServiceType, TestService::MessageType::OnBoardConnectionTest,
+		                          Message::TC, 1);
+		onBoardConnection.appendUint16(applicationID);
+		MessageParser::execute(onBoardConnection);
+		CHECK(ServiceTests::count() == 1);
+	}
+}
+
+TEST_CASE("Addition of report types outside the forwarding filter") {
+	Services.reset();
+	Message request(RealTimeForwardingControlService::ServiceType,
+	                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration, Message::TC,
+	                1);
+
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+	request.appendUint8(1);
+	request.appendUint8(applicationID);
+	request.appendUint8(2);
+	request.appendUint8(ECSSForwardingFilterServiceTypes);
+	request.appendUint8(1);
+	request.appendUint8(1);
+	request.appendUint8(HousekeepingService::ServiceType);
+	request.appendUint8(1);
+	request.appendUint8(ECSSForwardingFilterMessageTypes);
+
+	MessageParser::execute(request);
+
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::ReportTypeNotForwardable) == 2);
+	CHECK(realTimeForwarding.applicationProcessConfiguration.definitions.empty());
+}
+
+TEST_CASE("TC[14,2] Delete report types from the Application Process Configuration") {
+	ServiceTests::reset();
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+
+	Message addition(RealTimeForwardingControlService::ServiceType,
+	                 RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration, Message::TC,
+	                 1);
+	validReportTypes(addition);
+	MessageParser::execute(addition);
+
+	auto& configuration = realTimeForwarding.applicationProcessConfiguration;
+	auto& definitions = configuration.definitions;
+	REQUIRE(definitions.size() == 2);
+
+	SECTION("Report types, service types and application processes") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+		                Message::TC, 1);
+		request.appendUint8(1);
+		request.appendUint8(applicationID);
+		request.appendUint8(2);
+		request.appendUint8(services[0]);
+		request.appendUint8(1);
+		request.appendUint8(messages1[0]);
+		request.appendUint8(services[1]);
+		request.appendUint8(0);
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::count() == 0);
+		REQUIRE(definitions.size() == 1);
+		REQUIRE(definitions[std::make_pair(applicationID, services[0])].size() == 1);
+		CHECK(not configuration.isReportTypeForwarded(applicationID, services[0], messages1[0]));
+		CHECK(configuration.isReportTypeForwarded(applicationID, services[0], messages1[1]));
+		CHECK(not configuration.isReportTypeForwarded(applicationID, services[1], messages2[0]));
+
+		Message applicationRequest(
+		    RealTimeForwardingControlService::ServiceType,
+		    RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration, Message::TC, 1);
+		applicationRequest.appendUint8(1);
+		applicationRequest.appendUint8(applicationID);
+		applicationRequest.appendUint8(0);
+		MessageParser::execute(applicationRequest);
+
+		CHECK(ServiceTests::count() == 0);
+		CHECK(definitions.empty());
+		CHECK(not configuration.isReportTypeForwarded(applicationID, services[0], messages1[1]));
+	}
+
+	SECTION("Definitions that do not exist") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+		                Message::TC, 1);
+		request.appendUint8(2);
+		request.appendUint8(applicationID);
+		request.appendUint8(2);
+		request.appendUint8(services[0]);
+		request.appendUint8(1);
+		request.appendUint8(HousekeepingService::MessageType::HousekeepingParametersReport);
+		request.appendUint8(TestService::ServiceType);
+		request.appendUint8(0);
+		request.appendUint8(applicationID + 1);
+		request.appendUint8(0);
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::countThrownErrors(
+		          ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition) == 3);
+		CHECK(definitions.size() == 2);
+	}
+
+	SECTION("Whole configuration") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+		                Message::TC, 1);
+		request.appendUint8(0);
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::count() == 0);
+		CHECK(definitions.empty());
+		CHECK(not configuration.isReportTypeForwarded(applicationID, services[1], messages2[1]));
+	}
+}
+
+TEST_CASE("TC[14,3] Report the content of the Application Process Configuration") {
+	ServiceTests::reset();
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+
+	Message addition(RealTimeForwardingControlService::ServiceType,
+	                 RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration, Message::TC,
+	                 1);
+	validReportTypes(addition);
+	MessageParser::execute(addition);
+
+	Message request(RealTimeForwardingControlService::ServiceType,
+	                RealTimeForwardingControlService::MessageType::ReportAppProcessConfigurationContent, Message::TC, 1);
+	MessageParser::execute(request);
+
+	REQUIRE(ServiceTests::count() == 1);
+	Message report = ServiceTests::get(0);
+	CHECK(report.messageType == RealTimeForwardingControlService::MessageType::AppProcessConfigurationContentReport);
+	REQUIRE(report.dataSize == 11);
+	CHECK(report.readUint8() == 1);
+	CHECK(report.readUint8() == applicationID);
+	CHECK(report.readUint8() == 2);
+	for (uint8_t j = 0; j < 2; j++) {
+		uint8_t* messages = (j == 0) ? messages1 : messages2;
+		CHECK(report.readUint8() == services[j]);
+		CHECK(report.readUint8() == 2);
+		CHECK(report.readUint8() == messages[0]);
+		CHECK(report.readUint8() == messages[1]);
+	}
+}
+
+namespace {
+	/**
+	 * Executes a request of ST[14] that contains a list of identifiers for a single application process
+	 */
+	template <typename Identifier>
+	void executeIdentifiersRequest(uint8_t messageType, uint8_t applicationID,
+	                               std::initializer_list<Identifier> identifiers) {
+		Message request(RealTimeForwardingControlService::ServiceType, messageType, Message::TC, 1);
+		request.appendUint8(1);
+		request.appendUint8(applicationID);
+		request.appendUint16(identifiers.size());
+		for (auto identifier: identifiers) {
+			request.append<Identifier>(identifier);
+		}
+		MessageParser::execute(request);
+	}
+
+	/**
+	 * Adds a report type of a service to the Application Process Configuration
+	 */
+	void forwardReportType(uint8_t applicationID, uint8_t serviceType, uint8_t messageType) {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+		                Message::TC, 1);
+		request.appendUint8(1);
+		request.appendUint8(applicationID);
+		request.appendUint8(1);
+		request.appendUint8(serviceType);
+		request.appendUint8(1);
+		request.appendUint8(messageType);
+		MessageParser::execute(request);
+	}
+} // namespace
+
+TEST_CASE("TC[14,5], TC[14,6], TC[14,7] Housekeeping report configuration") {
+	ServiceTests::reset();
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+	forwardReportType(applicationID, HousekeepingService::ServiceType,
+	                  HousekeepingService::MessageType::HousekeepingParametersReport);
+
+	auto housekeepingReport = [applicationID](uint8_t structureID) {
+		Message report(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingParametersReport,
+		               Message::TM, applicationID);
+		report.appendUint8(structureID);
+		return report;
+	};
+	auto& configuration = realTimeForwarding.housekeepingReportConfiguration;
+
+	SECTION("Addition and deletion of structures") {
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, applicationID,
+		    {2, 7});
+		CHECK(configuration.contains(applicationID, 2));
+		CHECK(configuration.contains(applicationID, 7));
+		CHECK(realTimeForwarding.isReportForwarded(housekeepingReport(2)));
+		CHECK(not realTimeForwarding.isReportForwarded(housekeepingReport(3)));
+
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		    applicationID, {2});
+		CHECK(not realTimeForwarding.isReportForwarded(housekeepingReport(2)));
+		CHECK(realTimeForwarding.isReportForwarded(housekeepingReport(7)));
+		CHECK(ServiceTests::count() == 0);
+
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::ReportHousekeepingConfigurationContent,
+		                Message::TC, 1);
+		MessageParser::execute(request);
+
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType ==
+		      RealTimeForwardingControlService::MessageType::HousekeepingConfigurationContentReport);
+		REQUIRE(report.dataSize == 5);
+		CHECK(report.readUint8() == 1);
+		CHECK(report.readUint8() == applicationID);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.readUint8() == 7);
+	}
+
+	SECTION("All structures of an application process") {
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, applicationID, {});
+		CHECK(realTimeForwarding.isReportForwarded(housekeepingReport(0)));
+		CHECK(realTimeForwarding.isReportForwarded(housekeepingReport(255)));
+
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		    applicationID, {});
+		CHECK(not realTimeForwarding.isReportForwarded(housekeepingReport(0)));
+		CHECK(ServiceTests::count() == 0);
+
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		    applicationID, {4});
+		CHECK(ServiceTests::countThrownErrors(
+		          ErrorHandler::ExecutionStartErrorType::NonExistentForwardControlDefinition) == 1);
+	}
+
+	SECTION("Application process not controlled") {
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, applicationID + 1,
+		    {2, 7});
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::NotControlledApplication) == 1);
+		CHECK(configuration.size() == 0);
+	}
+
+	SECTION("No space for another application process") {
+		realTimeForwarding.controlledApplications.clear();
+		for (uint8_t id = 0; id < ECSSMaxControlledApplicationProcesses; id++) {
+			realTimeForwarding.controlledApplications.push_back(id + 10);
+			executeIdentifiersRequest<uint8_t>(
+			    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, id + 10, {1});
+		}
+		realTimeForwarding.controlledApplications.pop_back();
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, applicationID,
+		    {2, 7});
+		executeIdentifiersRequest<uint8_t>(
+		    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, applicationID, {});
+		CHECK(ServiceTests::countThrownErrors(
+		          ErrorHandler::ExecutionStartErrorType::MaxForwardControlApplicationsReached) == 2);
+		CHECK(ServiceTests::countErrors() == 2);
+		CHECK(not configuration.contains(applicationID, 2));
+	}
+
+	SECTION("Content split across reports") {
+		realTimeForwarding.controlledApplications.clear();
+		for (uint8_t id = 0; id < ECSSMaxControlledApplicationProcesses; id++) {
+			realTimeForwarding.controlledApplications.push_back(id);
+			executeIdentifiersRequest<uint8_t>(
+			    RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration, id, {});
+		}
+		realTimeForwarding.housekeepingConfigurationContentReport();
+
+		const uint16_t structureCount = UINT8_MAX + 1;
+		uint16_t reportedStructures = 0;
+		REQUIRE(ServiceTests::count() > 1);
+		for (uint16_t index = 0; index < ServiceTests::count(); index++) {
+			Message report = ServiceTests::get(index);
+			CHECK(report.messageType ==
+			      RealTimeForwardingControlService::MessageType::HousekeepingConfigurationContentReport);
+			CHECK(report.dataSize <= ECSSMaxMessageSize);
+
+			uint8_t numOfApplications = report.readUint8();
+			for (uint8_t i = 0; i < numOfApplications; i++) {
+				// The structures of each application process are listed in order, across reports
+				CHECK(report.readUint8() == reportedStructures / structureCount);
+				uint16_t numOfStructures = report.readUint16();
+				for (uint16_t j = 0; j < numOfStructures; j++) {
+					CHECK(report.readUint8() == reportedStructures % structureCount);
+					reportedStructures++;
+				}
+			}
+			CHECK(report.readPosition == report.dataSize);
+		}
+		CHECK(reportedStructures == ECSSMaxControlledApplicationProcesses * structureCount);
+	}
+}
+
+TEST_CASE("TC[14,9], TC[14,10], TC[14,11] Event report blocking configuration") {
+	ServiceTests::reset();
+	uint8_t applicationID = 1;
+	realTimeForwarding.controlledApplications.push_back(applicationID);
+	forwardReportType(applicationID, EventReportService::ServiceType,
+	                  EventReportService::MessageType::InformativeEventReport);
+
+	auto eventReport = [applicationID](uint16_t eventDefinitionID) {
+		Message report(EventReportService::ServiceType, EventReportService::MessageType::InformativeEventReport,
+		               Message::TM, applicationID);
+		report.appendEnum16(eventDefinitionID);
+		return report;
+	};
+
+	CHECK(realTimeForwarding.isReportForwarded(eventReport(5)));
+
+	executeIdentifiersRequest<uint16_t>(
+	    RealTimeForwardingControlService::MessageType::AddEventDefinitionsToEventReportBlocking, applicationID,
+	    {5, 1000, ECSSEventDefinitionCount});
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::InvalidEventDefinitionID) == 1);
+	CHECK(not realTimeForwarding.isReportForwarded(eventReport(5)));
+	CHECK(not realTimeForwarding.isReportForwarded(eventReport(1000)));
+	CHECK(realTimeForwarding.isReportForwarded(eventReport(6)));
+
+	executeIdentifiersRequest<uint16_t>(
+	    RealTimeForwardingControlService::MessageType::DeleteEventDefinitionsFromEventReportBlocking, applicationID,
+	    {5});
+	CHECK(realTimeForwarding.isReportForwarded(eventReport(5)));
+
+	Message request(RealTimeForwardingControlService::ServiceType,
+	                RealTimeForwardingControlService::MessageType::ReportEventReportBlockingContent, Message::TC, 1);
+	MessageParser::execute(request);
+
+	REQUIRE(ServiceTests::countSentMessages(
+	            RealTimeForwardingControlService::ServiceType,
+	            RealTimeForwardingControlService::MessageType::EventReportBlockingContentReport) == 1);
+	Message report = ServiceTests::get(ServiceTests::count() - 1);
+	REQUIRE(report.dataSize == 6);
+	CHECK(report.readUint8() == 1);
+	CHECK(report.readUint8() == applicationID);
+	CHECK(report.readUint16() == 1);
+	CHECK(report.readEnum16() == 1000);
+
+	Message clearRequest(RealTimeForwardingControlService::ServiceType,
+	                     RealTimeForwardingControlService::MessageType::DeleteEventDefinitionsFromEventReportBlocking,
+	                     Message::TC, 1);
+	clearRequest.appendUint8(0);
+	MessageParser::execute(clearRequest);
+	CHECK(realTimeForwarding.isReportForwarded(eventReport(1000)));
+}
+
+TEST_CASE("TM[14,12] Event report blocking content split across reports") {
+	ServiceTests::reset();
+	for (uint8_t applicationID = 1; applicationID <= 2; applicationID++) {
+		realTimeForwarding.controlledApplications.push_back(applicationID);
+		executeIdentifiersRequest<uint16_t>(
+		    RealTimeForwardingControlService::MessageType::AddEventDefinitionsToEventReportBlocking, applicationID, {});
+	}
+	realTimeForwarding.eventReportBlockingContentReport();
+
+	uint16_t reportedEvents[2] = {0, 0};
+	REQUIRE(ServiceTests::count() > 1);
+	for (uint16_t index = 0; index < ServiceTests::count(); index++) {
+		Message report = ServiceTests::get(index);
+		CHECK(report.messageType == RealTimeForwardingControlService::MessageType::EventReportBlockingContentReport);
+		CHECK(report.dataSize <= ECSSMaxMessageSize);
+
+		uint8_t numOfApplications = report.readUint8();
+		for (uint8_t i = 0; i < numOfApplications; i++) {
+			uint8_t applicationID = report.readUint8();
+			REQUIRE((applicationID == 1 or applicationID == 2));
+			uint16_t numOfEvents = report.readUint16();
+			for (uint16_t j = 0; j < numOfEvents; j++) {
+				CHECK(report.readEnum16() == reportedEvents[applicationID - 1]);
+				reportedEvents[applicationID - 1]++;
+			}
+		}
+	}
+	CHECK(reportedEvents[0] == ECSSEventDefinitionCount);
+	CHECK(reportedEvents[1] == ECSSEventDefinitionCount);
+}
@@ -77,6 +77,19 @@ public:
 		return queuedMessages.size();
 	}
 
+	/**
+	 * Counts the number of messages in the queue with the given service and message type
+	 */
+	static uint64_t countSentMessages(uint8_t serviceType, uint8_t messageType) {
+		uint64_t messages = 0;
+		for (const auto& message: queuedMessages) {
+			if (message.serviceType == serviceType and message.messageType == messageType) {
+				messages++;
+			}
+		}
+		return messages;
+	}
+
 	/**
 	 * Checks that there is *exactly* one message in the list of queued messages
 	 */
@@ -17,18 +17,43 @@ namespace unit_test {
 		}
 
 		/*
-		 * Read the private member scheduled activities and since it is a list and it can't be
-		 * accessed, get each element and save it to a vector.
+		 * Read the private member scheduled activities and, since they are not stored in order, get
+		 * each element in order of release time and save it to a vector.
 		 */
 		static auto scheduledActivities(TimeBasedSchedulingService& tmService) {
 			std::vector<TimeBasedSchedulingService::ScheduledActivity*> listElements;
 
-			std::transform(
-			    tmService.scheduledActivities.begin(), tmService.scheduledActivities.end(),
-			    std::back_inserter(listElements), [](auto& activity) -> auto{ return &activity; });
+			tmService.scheduledActivities.forEachInOrder(
+			    [&listElements](auto& activity) { listElements.push_back(&activity); });
 
 			return listElements; // Return the list elements
 		}
+
+		/*
+		 * Get the release time of a scheduled activity, including the time shift of the schedule
+		 */
+		static Time::CustomCUC_t releaseTime(TimeBasedSchedulingService& tmService,
+		                                     TimeBasedSchedulingService::ScheduledActivity* activity) {
+			return tmService.releaseTimeOf(*activity);
+		}
+
+		/*
+		 * Rebuild the TC packet of a scheduled activity
+		 */
+		static Message request(TimeBasedSchedulingService& tmService,
+		                       TimeBasedSchedulingService::ScheduledActivity* activity) {
+			return tmService.getRequest(*activity);
+		}
+
+		/*
+		 * Change the application ID of the request ID of a scheduled activity
+		 */
+		static void setApplicationID(TimeBasedSchedulingService& tmService,
+		                             TimeBasedSchedulingService::ScheduledActivity* activity, uint16_t applicationID) {
+			auto requestID = activity->requestID;
+			requestID.applicationID = applicationID;
+			tmService.scheduledActivities.setRequestID(*activity, requestID);
+		}
 	};
 } // namespace unit_test
 
@@ -37,7 +62,7 @@ Time::CustomCUC_t currentTime = TimeGetter::getCurrentTimeCustomCUC(); // Get th
 bool messagesPopulated = false;                                        // Indicate whether the test messages are initialized
 
 // Run this function to set the service up before moving on with further testing
-auto activityInsertion(TimeBasedSchedulingService& timeService) {
+auto activityInsertion(TimeBasedSchedulingService& timeService, uint8_t subScheduleID = 0) {
 	if (not messagesPopulated) {
 		// Initialize the test messages
 		testMessage1.serviceType = 6;
@@ -66,23 +91,38 @@ auto activityInsertion(TimeBasedSchedulingService& timeService) {
 	}
 
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+#if SUB_SCHEDULES_ENABLED
+	receivedMessage.appendUint8(subScheduleID);
+#endif
 	receivedMessage.appendUint16(4); // Total number of requests
 
 	// Test activity 1
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(1); // Group ID
+#endif
 	receivedMessage.appendCustomCUCTimeStamp(currentTime + 1556435);
-	receivedMessage.appendMessage(testMessage1, ECSSTCRequestStringSize);
+	receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage1));
 
 	// Test activity 2
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(2); // Group ID
+#endif
 	receivedMessage.appendCustomCUCTimeStamp(currentTime + 1957232);
-	receivedMessage.appendMessage(testMessage2, ECSSTCRequestStringSize);
+	receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage2));
 
 	// Test activity 3
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(1); // Group ID
+#endif
 	receivedMessage.appendCustomCUCTimeStamp(currentTime + 1726435);
-	receivedMessage.appendMessage(testMessage3, ECSSTCRequestStringSize);
+	receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage3));
 
 	// Test activity 4
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(2); // Group ID
+#endif
 	receivedMessage.appendCustomCUCTimeStamp(currentTime + 17248435);
-	receivedMessage.appendMessage(testMessage4, ECSSTCRequestStringSize);
+	receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage4));
 
 	// Insert activities in the schedule. They have to be inserted sorted
 	timeService.insertActivities(receivedMessage);
@@ -90,6 +130,25 @@ auto activityInsertion(TimeBasedSchedulingService& timeService) {
 	return unit_test::Tester::scheduledActivities(timeService); // Return the activities vector
 }
 
+/*
+ * Read the sub-schedule and group IDs of an activity from a TM[11,10] or TM[11,13] report, and check
+ * that they match the expected activity
+ */
+template <typename Activity>
+void readSubScheduleAndGroup(Message& report, const Activity* expectedActivity) {
+#if SUB_SCHEDULES_ENABLED
+	CHECK(report.readUint8() == expectedActivity->subScheduleID);
+#endif
+#if GROUPS_ENABLED
+	CHECK(report.readUint8() == expectedActivity->groupID);
+#endif
+}
+
+// Read the TC packet of an activity from a TM[11,10] report
+Message readRequest(Message& report) {
+	auto request = report.readOctetString<ECSSMaxMessageSize>();
+	return *MessageParser::parseECSSTC(reinterpret_cast<const uint8_t*>(request.data()), request.size());
+}
 
 TimeBasedSchedulingService& timeBasedService = Services.timeBasedScheduling;
 
@@ -134,6 +193,42 @@ TEST_CASE("Execute the first activity, removes it from the list and return the r
 	REQUIRE(iterationCount == 0);
 }
 
+TEST_CASE("Release all due activities in one call") {
+	Services.reset();
+
+	SECTION("Empty schedule") {
+		auto nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime);
+		CHECK(nextWakeUpTime.elapsed100msTicks == std::numeric_limits<decltype(nextWakeUpTime.elapsed100msTicks)>::max());
+		CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 0);
+	}
+
+	SECTION("All due activities") {
+		activityInsertion(timeBasedService);
+
+		auto nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime + 1957232);
+		CHECK(nextWakeUpTime == currentTime + 17248435);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == 1);
+
+		const auto& statistics = timeBasedService.getReleaseStatistics();
+		CHECK(statistics.releasedActivities == 3);
+		CHECK(statistics.maxReleaseLatency == (1957232 - 1556435) * 10);
+		CHECK(statistics.totalReleaseLatency == (1957232 - 1556435) * 10 + (1957232 - 1726435) * 10);
+	}
+
+	SECTION("Limited number of activities per call") {
+		activityInsertion(timeBasedService);
+
+		// Due activities are left for the next call, which is due immediately
+		auto nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime + 1957232, 2);
+		CHECK(nextWakeUpTime == currentTime + 1957232);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == 2);
+
+		nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime + 1957232, 2);
+		CHECK(nextWakeUpTime == currentTime + 17248435);
+		CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 3);
+	}
+}
+
 TEST_CASE("TC[11,1] Enable Schedule Execution", "[service][st11]") {
 	Services.reset();
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableTimeBasedScheduleExecutionFunction, Message::TC, 1);
@@ -156,27 +251,142 @@ TEST_CASE("TC[11,4] Activity Insertion", "[service][st11]") {
 
 	REQUIRE(scheduledActivities.size() == 4);
 
-	REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 1556435);
-	REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 1726435);
-	REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 1957232);
-	REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 17248435);
+	REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)) == currentTime + 1556435);
+	REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(1)) == currentTime + 1726435);
+	REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)) == currentTime + 1957232);
+	REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(3)) == currentTime + 17248435);
 
-	REQUIRE(testMessage1.bytesEqualWith(scheduledActivities.at(0)->request));
-	REQUIRE(testMessage3.bytesEqualWith(scheduledActivities.at(1)->request));
-	REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(2)->request));
-	REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(3)->request));
+	REQUIRE(testMessage1.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(0))));
+	REQUIRE(testMessage3.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(1))));
+	REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(2))));
+	REQUIRE(testMessage4.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(3))));
 
 	SECTION("Error throw test") {
 		Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+#if SUB_SCHEDULES_ENABLED
+		receivedMessage.appendUint8(0); // Sub-schedule ID
+#endif
 		receivedMessage.appendUint16(1); // Total number of requests
 
+#if GROUPS_ENABLED
+		receivedMessage.appendUint8(0); // Group ID
+#endif
 		receivedMessage.appendCustomCUCTimeStamp(currentTime - 1556435);
+		receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage1));
 		MessageParser::execute(receivedMessage); //timeService.insertActivities(receivedMessage);
 
 		REQUIRE(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
 	}
 }
 
+// A TC[11,4] request that inserts \p count copies of \p message, released one after the other
+Message insertionRequest(const Message& message, uint16_t count) {
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+#if SUB_SCHEDULES_ENABLED
+	receivedMessage.appendUint8(0); // Sub-schedule ID
+#endif
+	receivedMessage.appendUint16(count);
+	for (uint16_t i = 0; i < count; i++) {
+#if GROUPS_ENABLED
+		receivedMessage.appendUint8(0); // Group ID
+#endif
+		receivedMessage.appendCustomCUCTimeStamp(currentTime + 1556435 + i);
+		receivedMessage.appendOctetString(MessageParser::composeECSS(message));
+	}
+	return receivedMessage;
+}
+
+// A TC of 300 bytes of data, longer than the fixed size of the TCs of other services
+Message largeTestMessage() {
+	Message largeMessage(6, 5, Message::TC, 1);
+	for (uint16_t i = 0; i < 300; i++) {
+		largeMessage.appendUint8(i);
+	}
+	return largeMessage;
+}
+
+TEST_CASE("TC[11,4] Activity insertion of a long TC", "[service][st11]") {
+	Services.reset();
+	Message largeMessage = largeTestMessage();
+
+	Message receivedMessage = insertionRequest(largeMessage, 1);
+	MessageParser::execute(receivedMessage);
+
+	auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 1);
+	CHECK(largeMessage.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(0))));
+
+	Message reportRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DetailReportAllScheduledActivities, Message::TC, 1);
+	MessageParser::execute(reportRequest);
+	REQUIRE(ServiceTests::hasOneMessage());
+
+	Message response = ServiceTests::get(0);
+	CHECK(response.readUint16() == 1);
+	readSubScheduleAndGroup(response, scheduledActivities.at(0));
+	CHECK(response.readCustomCUCTimeStamp() == currentTime + 1556435);
+	CHECK(largeMessage.bytesEqualWith(readRequest(response)));
+}
+
+TEST_CASE("TC[11,4] Activity insertion when the space of the schedule is exhausted", "[service][st11]") {
+	Services.reset();
+	Message largeMessage = largeTestMessage();
+
+	// Each TC takes 305 bytes plus the header of its entry
+	const uint16_t fittingActivities = ECSSTimeSchedRequestArenaSize / (305 + 4);
+	Message receivedMessage = insertionRequest(largeMessage, 3);
+	for (uint16_t i = 0; i < fittingActivities / 3; i++) {
+		receivedMessage.resetRead();
+		MessageParser::execute(receivedMessage);
+	}
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == (fittingActivities / 3) * 3);
+
+	Message overflowMessage = insertionRequest(largeMessage, 3);
+	MessageParser::execute(overflowMessage);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::InstructionExecutionStartError) ==
+	      3 - (fittingActivities % 3));
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == fittingActivities);
+
+	// Deleting an activity frees its space
+	Message deleteMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteActivitiesById, Message::TC, 1);
+	deleteMessage.appendUint16(1);
+	deleteMessage.appendUint8(0);  // Source ID
+	deleteMessage.appendUint16(1); // Application ID
+	deleteMessage.appendUint16(0); // Sequence count
+	MessageParser::execute(deleteMessage);
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == fittingActivities - 1);
+
+	overflowMessage.resetRead();
+	MessageParser::execute(overflowMessage);
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == fittingActivities);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::InstructionExecutionStartError) ==
+	      3 - (fittingActivities % 3) + 2);
+}
+
+TEST_CASE("TC[11,4] Activity insertion of a malformed TC", "[service][st11]") {
+	Services.reset();
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+#if SUB_SCHEDULES_ENABLED
+	receivedMessage.appendUint8(0); // Sub-schedule ID
+#endif
+	receivedMessage.appendUint16(2);
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(0); // Group ID
+#endif
+	receivedMessage.appendCustomCUCTimeStamp(currentTime + 1556435);
+	receivedMessage.appendUint16(3); // Shorter than the PUS header
+	receivedMessage.appendUint8(ECSSPUSVersion << 4U);
+	receivedMessage.appendUint16(0);
+#if GROUPS_ENABLED
+	receivedMessage.appendUint8(0); // Group ID
+#endif
+	receivedMessage.appendCustomCUCTimeStamp(currentTime + 1556435);
+	receivedMessage.appendOctetString(MessageParser::composeECSS(testMessage1));
+	MessageParser::execute(receivedMessage);
+
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::InstructionExecutionStartError) == 1);
+	CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == 1);
+}
+
 TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 	Services.reset();
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::TimeShiftALlScheduledActivities, Message::TC, 1);
@@ -190,10 +400,10 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 		CHECK(scheduledActivities.size() == 4);
 		MessageParser::execute(receivedMessage); //timeService.timeShiftAllActivities(receivedMessage);
 
-		REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 1556435 - timeShift);
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 1726435 - timeShift);
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 1957232 - timeShift);
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 17248435 - timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)) == currentTime + 1556435 - timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(1)) == currentTime + 1726435 - timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)) == currentTime + 1957232 - timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(3)) == currentTime + 17248435 - timeShift);
 	}
 
 	SECTION("Negative Shift") {
@@ -201,10 +411,10 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 
 		CHECK(scheduledActivities.size() == 4);
 		MessageParser::execute(receivedMessage); //timeService.timeShiftAllActivities(receivedMessage);
-		REQUIRE(scheduledActivities.at(0)->requestReleaseTime == currentTime + 1556435 + timeShift);
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 1726435 + timeShift);
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 1957232 + timeShift);
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 17248435 + timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)) == currentTime + 1556435 + timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(1)) == currentTime + 1726435 + timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)) == currentTime + 1957232 + timeShift);
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(3)) == currentTime + 17248435 + timeShift);
 	}
 
 	SECTION("Error throwing") {
@@ -217,12 +427,41 @@ TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
 	}
 }
 
+TEST_CASE("TC[11,15] Time shift of the schedule applied to later activities", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService);
+	const Time::RelativeTime timeShift = 6789;
+
+	Message shiftMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::TimeShiftALlScheduledActivities, Message::TC, 1);
+	shiftMessage.appendRelativeTime(timeShift);
+	MessageParser::execute(shiftMessage);
+
+	// An activity inserted after the shift is not shifted, but is ordered among the shifted ones
+	Message receivedMessage = insertionRequest(testMessage1, 1);
+	MessageParser::execute(receivedMessage);
+
+	auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 5);
+	CHECK(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)) == currentTime + 1556435);
+	CHECK(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(1)) == currentTime + 1556435 + timeShift);
+	CHECK(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(4)) == currentTime + 17248435 + timeShift);
+
+	auto nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime + 1556435);
+	CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 1);
+	CHECK(nextWakeUpTime == currentTime + 1556435 + timeShift);
+
+	nextWakeUpTime = timeBasedService.releaseDueActivities(currentTime + 1957232 + timeShift);
+	CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 4);
+	CHECK(timeBasedService.getReleaseStatistics().maxReleaseLatency == (1957232 - 1556435) * 10);
+	CHECK(nextWakeUpTime == currentTime + 17248435 + timeShift);
+}
+
 TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 	Services.reset();
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::TimeShiftActivitiesById, Message::TC, 1);
 
 	auto scheduledActivities = activityInsertion(timeBasedService);
-	scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+	unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(2), 4); // Append a dummy application ID
 	CHECK(scheduledActivities.size() == 4);
 
 	const Time::RelativeTime timeShift = 67890000; // Relative time-shift value
@@ -238,8 +477,8 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		// Make sure the new value is inserted sorted
-		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 1957232 + timeShift);
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(3)->request));
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(3)) == currentTime + 1957232 + timeShift);
+		REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(3))));
 	}
 
 	SECTION("Negative Shift") {
@@ -253,8 +492,8 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		// Output should be sorted
-		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 1957232 - 250000);
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(1)->request));
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(1)) == currentTime + 1957232 - 250000);
+		REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(1))));
 	}
 
 	SECTION("Error throw on wrong request ID") {
@@ -289,8 +528,8 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 	SECTION("Detailed activity report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(0), 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(2), 4); // Append a dummy application ID
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.appendUint8(0);                           // Source ID is not implemented
@@ -311,18 +550,16 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 		uint16_t iterationCount = response.readUint16();
 		CHECK(iterationCount == 2);
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			readSubScheduleAndGroup(response, scheduledActivities.at(i == 0 ? 0 : 2));
 			Time::CustomCUC_t receivedReleaseTime = response.readCustomCUCTimeStamp();
 
-			Message receivedTCPacket;
-			uint8_t receivedDataStr[ECSSTCRequestStringSize];
-			response.readString(receivedDataStr, ECSSTCRequestStringSize);
-			receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
+			Message receivedTCPacket = readRequest(response);
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(0)->request);
+				REQUIRE(receivedReleaseTime == unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)));
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, scheduledActivities.at(0)));
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(2)->request);
+				REQUIRE(receivedReleaseTime == unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)));
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, scheduledActivities.at(2)));
 			}
 		}
 	}
@@ -347,8 +584,8 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 	SECTION("Summary report") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(0), 8); // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(2), 4); // Append a dummy application ID
 
 		receivedMessage.appendUint16(2);                          // Two instructions in the request
 		receivedMessage.appendUint8(0);                           // Source ID is not implemented
@@ -368,18 +605,19 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 
 		uint16_t iterationCount = response.readUint16();
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			readSubScheduleAndGroup(response, scheduledActivities.at(i == 0 ? 0 : 2));
 			Time::CustomCUC_t receivedReleaseTime = response.readCustomCUCTimeStamp();
 			uint8_t receivedSourceID = response.readUint8();
 			uint16_t receivedApplicationID = response.readUint16();
 			uint16_t receivedSequenceCount = response.readUint16();
 
 			if (i == 0) {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
+				REQUIRE(receivedReleaseTime == unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(0)));
 				REQUIRE(receivedSourceID == scheduledActivities.at(0)->requestID.sourceID);
 				REQUIRE(receivedApplicationID == scheduledActivities.at(0)->requestID.applicationID);
 				REQUIRE(receivedSequenceCount == scheduledActivities.at(0)->requestID.sequenceCount);
 			} else {
-				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
+				REQUIRE(receivedReleaseTime == unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)));
 				REQUIRE(receivedSourceID == scheduledActivities.at(2)->requestID.sourceID);
 				REQUIRE(receivedApplicationID == scheduledActivities.at(2)->requestID.applicationID);
 				REQUIRE(receivedSequenceCount == scheduledActivities.at(2)->requestID.sequenceCount);
@@ -414,14 +652,51 @@ TEST_CASE("TC[11,16] Detail report all scheduled activities", "[service][st11]")
 	REQUIRE(iterationCount == scheduledActivities.size());
 
 	for (uint16_t i = 0; i < iterationCount; i++) {
+		readSubScheduleAndGroup(response, scheduledActivities.at(i));
 		Time::CustomCUC_t receivedReleaseTime = response.readCustomCUCTimeStamp();
 
-		Message receivedTCPacket;
-		uint8_t receivedDataStr[ECSSTCRequestStringSize];
-		response.readString(receivedDataStr, ECSSTCRequestStringSize);
-		receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
-		REQUIRE(receivedReleaseTime == scheduledActivities.at(i)->requestReleaseTime);
-		REQUIRE(receivedTCPacket.bytesEqualWith(scheduledActivities.at(i)->request));
+		Message receivedTCPacket = readRequest(response);
+		REQUIRE(receivedReleaseTime == unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(i)));
+		REQUIRE(receivedTCPacket.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(i))));
+	}
+}
+
+TEST_CASE("TC[11,16] Detail report of activities that do not fit in one report", "[service][st11]") {
+	Services.reset();
+	Message largeMessage = largeTestMessage();
+
+	// Each report fits only 3 activities of 305-byte TCs
+	Message receivedMessage = insertionRequest(largeMessage, 3);
+	for (uint16_t i = 0; i < 3; i++) {
+		receivedMessage.resetRead();
+		MessageParser::execute(receivedMessage);
+	}
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 9);
+
+	Message reportRequest(TimeBasedSchedulingService::ServiceType,
+	                      TimeBasedSchedulingService::MessageType::DetailReportAllScheduledActivities, Message::TC, 1);
+	MessageParser::execute(reportRequest);
+	REQUIRE(ServiceTests::count() == 3);
+
+	Time::CustomCUC_t previousReleaseTime = currentTime;
+	for (uint16_t index = 0; index < 3; index++) {
+		Message response = ServiceTests::get(index);
+		CHECK(response.messageType == TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
+		CHECK(response.dataSize <= ECSSMaxMessageSize);
+
+		REQUIRE(response.readUint16() == 3);
+		for (uint16_t i = 0; i < 3; i++) {
+#if SUB_SCHEDULES_ENABLED
+			CHECK(response.readUint8() == 0);
+#endif
+#if GROUPS_ENABLED
+			CHECK(response.readUint8() == 0);
+#endif
+			Time::CustomCUC_t releaseTime = response.readCustomCUCTimeStamp();
+			CHECK(not(releaseTime < previousReleaseTime));
+			previousReleaseTime = releaseTime;
+			CHECK(largeMessage.bytesEqualWith(readRequest(response)));
+		}
 	}
 }
 
@@ -434,7 +709,7 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 	SECTION("Activity deletion") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
-		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::setApplicationID(timeBasedService, scheduledActivities.at(2), 4); // Append a dummy application ID
 
 		receivedMessage.appendUint16(1);                          // Just one instruction to delete an activity
 		receivedMessage.appendUint8(0);                           // Source ID is not implemented
@@ -446,8 +721,8 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 		scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
 
 		REQUIRE(scheduledActivities.size() == 3);
-		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 17248435);
-		REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(2)->request));
+		REQUIRE(unit_test::Tester::releaseTime(timeBasedService, scheduledActivities.at(2)) == currentTime + 17248435);
+		REQUIRE(testMessage4.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(2))));
 	}
 
 	SECTION("Error throw on wrong request ID") {
@@ -473,3 +748,102 @@ TEST_CASE("TC[11,3] Reset schedule", "[service][st11]") {
 	REQUIRE(scheduledActivities.empty());
 	REQUIRE(not unit_test::Tester::executionFunctionStatus(timeBasedService));
 }
+
+TEST_CASE("TC[11,24] and TC[11,25] Enable and disable groups", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService);
+
+	Message disableMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableGroups, Message::TC, 1);
+	disableMessage.appendUint16(1);
+	disableMessage.appendUint8(1);
+	MessageParser::execute(disableMessage);
+
+	// The activities of the disabled group are deleted when they are due, without being released
+	timeBasedService.releaseDueActivities(currentTime + 1957232);
+	CHECK(timeBasedService.getReleaseStatistics().skippedActivities == 2);
+	CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 1);
+
+	Message enableMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableGroups, Message::TC, 1);
+	enableMessage.appendUint16(0);
+	MessageParser::execute(enableMessage);
+
+	SECTION("Disabling all groups") {
+		disableMessage = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableGroups, Message::TC, 1);
+		disableMessage.appendUint16(0);
+		MessageParser::execute(disableMessage);
+
+		timeBasedService.releaseDueActivities(currentTime + 17248435);
+		CHECK(timeBasedService.getReleaseStatistics().skippedActivities == 3);
+	}
+
+	SECTION("Invalid group") {
+		disableMessage = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableGroups, Message::TC, 1);
+		disableMessage.appendUint16(1);
+		disableMessage.appendUint8(ECSSMaxTimeSchedGroups);
+		MessageParser::execute(disableMessage);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
+
+		timeBasedService.releaseDueActivities(currentTime + 17248435);
+		CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 2);
+	}
+}
+
+TEST_CASE("TC[11,23] Delete groups", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService);
+
+	Message deleteMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteGroups, Message::TC, 1);
+	deleteMessage.appendUint16(1);
+	deleteMessage.appendUint8(2);
+	MessageParser::execute(deleteMessage);
+
+	auto scheduledActivities = unit_test::Tester::scheduledActivities(timeBasedService);
+	REQUIRE(scheduledActivities.size() == 2);
+	CHECK(testMessage1.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(0))));
+	CHECK(testMessage3.bytesEqualWith(unit_test::Tester::request(timeBasedService, scheduledActivities.at(1))));
+
+	Message reportMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportStatusOfGroups, Message::TC, 1);
+	MessageParser::execute(reportMessage);
+	REQUIRE(ServiceTests::hasOneMessage());
+
+	Message report = ServiceTests::get(0);
+	CHECK(report.messageType == TimeBasedSchedulingService::MessageType::GroupStatusReport);
+	REQUIRE(report.readUint16() == ECSSMaxTimeSchedGroups);
+	for (uint8_t groupID = 0; groupID < ECSSMaxTimeSchedGroups; groupID++) {
+		CHECK(report.readUint8() == groupID);
+		CHECK(report.readBoolean());
+		CHECK(report.readUint16() == ((groupID == 1) ? 2 : 0));
+	}
+}
+
+TEST_CASE("TC[11,20] and TC[11,21] Enable and disable sub-schedules", "[service][st11]") {
+	Services.reset();
+	activityInsertion(timeBasedService, 3);
+
+	Message disableMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DisableSubSchedules, Message::TC, 1);
+	disableMessage.appendUint16(1);
+	disableMessage.appendUint8(3);
+	MessageParser::execute(disableMessage);
+
+	Message reportMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportStatusOfSubSchedules, Message::TC, 1);
+	MessageParser::execute(reportMessage);
+	REQUIRE(ServiceTests::hasOneMessage());
+
+	Message report = ServiceTests::get(0);
+	CHECK(report.messageType == TimeBasedSchedulingService::MessageType::SubScheduleStatusReport);
+	REQUIRE(report.readUint16() == ECSSMaxTimeSchedSubSchedules);
+	for (uint8_t subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+		CHECK(report.readUint8() == subScheduleID);
+		CHECK(report.readBoolean() == (subScheduleID != 3));
+	}
+
+	timeBasedService.releaseDueActivities(currentTime + 17248435);
+	CHECK(timeBasedService.getReleaseStatistics().skippedActivities == 4);
+	CHECK(timeBasedService.getReleaseStatistics().releasedActivities == 0);
+
+	SECTION("Invalid sub-schedule") {
+		activityInsertion(timeBasedService, ECSSMaxTimeSchedSubSchedules);
+		CHECK(ServiceTests::thrownError(ErrorHandler::SubServiceExecutionStartError));
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+	}
+}
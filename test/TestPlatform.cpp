@@ -10,16 +10,11 @@
 #include "Services/ParameterService.hpp"
 #include "Services/ServiceTests.hpp"
 
-UTCTimestamp TimeGetter::getCurrentTimeUTC() {
-	UTCTimestamp currentTime(2020, 4, 10, 10, 15, 0);
-	return currentTime;
-}
-
-Time::CustomCUC_t TimeGetter::getCurrentTimeCustomCUC() {
-	UTCTimestamp timeUTC = getCurrentTimeUTC();
-	TimeStamp<Time::CUCSecondsBytes, Time::CUCFractionalBytes> timeCUC(timeUTC);
-	Time::CustomCUC_t CUCtime = timeCUC.asCustomCUCTimestamp();
-	return CUCtime;
+uint64_t TimeGetter::getPlatformTime() {
+	// 10 Apr 2020, 10:15:00
+	const uint64_t seconds = (Time::daysFromCivil(2020, 4, 10) - Time::EpochDaysFromUnix) * Time::SecondsPerDay +
+	                         10 * Time::SecondsPerHour + 15 * Time::SecondsPerMinute;
+	return seconds * NanosecondsPerSecond;
 }
 
 // Explicit template specializations for the logError() function
@@ -37,6 +32,13 @@ std::multimap<std::pair<ErrorHandler::ErrorSource, uint16_t>, bool> ServiceTests
 bool ServiceTests::expectingErrors = false;
 
 void Service::storeMessage(Message& message) {
+#ifdef SERVICE_REALTIMEFORWARDINGCONTROL
+	// Reports that ST[14] does not forward never reach the ground station
+	if (not Services.realTimeForwarding.isReportForwarded(message)) {
+		return;
+	}
+#endif
+
 	// Just add the message to the queue
 	ServiceTests::queue(message);
 }
@@ -1,4 +1,6 @@
 #include "Time/TimeStamp.hpp"
+#include <vector>
+#include "../Services/ServiceTests.hpp"
 #include "catch2/catch_all.hpp"
 
 using namespace Time;
@@ -159,6 +161,145 @@ TEST_CASE("UTC conversion to and from seconds timestamps") {
 	}
 }
 
+TEST_CASE("UTC conversion over several decades") {
+	// Walk every day until 2100, counting the days of each month, and compare with the closed-form conversion
+	uint32_t days = 0;
+	for (uint16_t year = Epoch.year; year < 2100; year++) {
+		for (uint8_t month = 1; month <= 12; month++) {
+			uint8_t monthDays = DaysOfMonth[month - 1] + ((month == 2 && isLeapYear(year)) ? 1 : 0);
+			for (uint8_t day = 1; day <= monthDays; day++) {
+				UTCTimestamp timestamp(year, month, day, 23, 59, 59);
+				TimeStamp<4, 1> time(timestamp);
+				REQUIRE(time.asTAIseconds() == days * SecondsPerDay + SecondsPerDay - 1);
+
+				bool cond = (time.toUTCtimestamp() == timestamp);
+				REQUIRE(cond);
+				days++;
+			}
+		}
+	}
+}
+
+TEST_CASE("UTC conversion benchmark", "[.][benchmark]") {
+	std::vector<UTCTimestamp> timestamps;
+	for (uint16_t year = Epoch.year; year < 2100; year += 5) {
+		timestamps.emplace_back(year, 12, 31, 23, 59, 59);
+	}
+
+	BENCHMARK("UTC to TAI seconds") {
+		uint64_t sum = 0;
+		for (const auto& timestamp: timestamps) {
+			sum += TimeStamp<4, 1>(timestamp).asTAIseconds();
+		}
+		return sum;
+	};
+
+	std::vector<TimeStamp<4, 1>> times;
+	for (const auto& timestamp: timestamps) {
+		times.emplace_back(timestamp);
+	}
+
+	BENCHMARK("TAI seconds to UTC") {
+		uint32_t sum = 0;
+		for (auto& time: times) {
+			sum += time.toUTCtimestamp().year;
+		}
+		return sum;
+	};
+}
+
+namespace {
+	/**
+	 * Checks that the batch encoding of a format matches the encoding of each timestamp, and that it can be decoded
+	 */
+	template <uint8_t secondsBytes, uint8_t fractionalBytes>
+	void checkBatchCUCEncoding() {
+		using Format = TimeStamp<secondsBytes, fractionalBytes>;
+		std::vector<Time::CustomCUC_t> customCUCs = {{0}, {1}, {1234}, {((1U << (8U * secondsBytes)) - 1) * 10 - 1}};
+		std::vector<Format> timestamps;
+		for (const auto& customCUC: customCUCs) {
+			timestamps.emplace_back(customCUC);
+		}
+
+		std::vector<uint8_t> encoded(timestamps.size() * Format::CUCTimestampSize);
+		Format::toCUCtimestamps(timestamps.data(), timestamps.size(), encoded.data());
+		for (size_t i = 0; i < timestamps.size(); i++) {
+			auto single = timestamps[i].toCUCtimestamp();
+			CHECK(std::equal(single.begin(), single.begin() + Format::CUCTimestampSize,
+			                 encoded.begin() + i * Format::CUCTimestampSize));
+		}
+
+		std::vector<uint8_t> encodedCustomCUCs(encoded.size());
+		Format::toCUCtimestamps(customCUCs.data(), customCUCs.size(), encodedCustomCUCs.data());
+		CHECK(encodedCustomCUCs == encoded);
+
+		std::vector<Format> decoded(timestamps.size());
+		CHECK(Format::fromCUCtimestamps(encoded.data(), timestamps.size(), decoded.data()) == timestamps.size());
+		CHECK(decoded == timestamps);
+
+		std::vector<Time::CustomCUC_t> decodedCustomCUCs(timestamps.size());
+		CHECK(Format::fromCUCtimestamps(encoded.data(), timestamps.size(), decodedCustomCUCs.data()) ==
+		      timestamps.size());
+		for (size_t i = 0; i < timestamps.size(); i++) {
+			CHECK(decodedCustomCUCs[i] == timestamps[i].asCustomCUCTimestamp());
+		}
+	}
+} // namespace
+
+TEST_CASE("CUC batch encoding") {
+	SECTION("Short header") {
+		checkBatchCUCEncoding<1, 0>();
+		checkBatchCUCEncoding<2, 2>();
+		checkBatchCUCEncoding<3, 1>();
+	}
+
+	SECTION("Long header") {
+		checkBatchCUCEncoding<2, 3>();
+		checkBatchCUCEncoding<3, 4>();
+	}
+
+	SECTION("Different format") {
+		std::vector<TimeStamp<2, 2>> timestamps(3);
+		std::vector<uint8_t> encoded(timestamps.size() * TimeStamp<2, 2>::CUCTimestampSize);
+		TimeStamp<2, 2>::toCUCtimestamps(timestamps.data(), timestamps.size(), encoded.data());
+
+		encoded[TimeStamp<2, 2>::CUCTimestampSize] = TimeStamp<2, 1>().toCUCtimestamp()[0];
+		CHECK(TimeStamp<2, 2>::fromCUCtimestamps(encoded.data(), timestamps.size(), timestamps.data()) == 1);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidTimeStampInput));
+	}
+}
+
+TEST_CASE("CUC batch encoding benchmark", "[.][benchmark]") {
+	std::vector<Time::CustomCUC_t> customCUCs;
+	for (uint32_t i = 0; i < 10000; i++) {
+		customCUCs.push_back({i * 7});
+	}
+	std::vector<AcubeSATTimeStamp_t> timestamps(customCUCs.size());
+	for (size_t i = 0; i < customCUCs.size(); i++) {
+		timestamps[i] = AcubeSATTimeStamp_t(customCUCs[i]);
+	}
+	std::vector<uint8_t> encoded(timestamps.size() * AcubeSATTimeStamp_t::CUCTimestampSize);
+
+	BENCHMARK("One timestamp at a time") {
+		uint8_t* output = encoded.data();
+		for (auto& timestamp: timestamps) {
+			auto bytes = timestamp.toCUCtimestamp();
+			std::copy(bytes.begin(), bytes.begin() + AcubeSATTimeStamp_t::CUCTimestampSize, output);
+			output += AcubeSATTimeStamp_t::CUCTimestampSize;
+		}
+		return encoded[0];
+	};
+
+	BENCHMARK("Batch encoding") {
+		AcubeSATTimeStamp_t::toCUCtimestamps(timestamps.data(), timestamps.size(), encoded.data());
+		return encoded[0];
+	};
+
+	BENCHMARK("Batch decoding") {
+		return AcubeSATTimeStamp_t::fromCUCtimestamps(encoded.data(), timestamps.size(), timestamps.data());
+	};
+}
+
 // SECTION("Check different templates, should break at compile"){
 //   TimeStamp<1, 2> time1;
 //   TimeStamp<4, 4> time2;